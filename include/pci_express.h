@@ -13,6 +13,7 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   2026.10    Added PCIe capability device and link control definitions
 //    09/2025   2026.01    Initial Version
 //
 //  This file is part of OSVVM.
@@ -70,6 +71,8 @@
 
 #define TS_DATA_RATE_GEN1          0x02
 #define TS_DATA_RATE_GEN2          0x06
+#define TS_DATA_RATE_GEN3          0x0e
+#define TS_DATA_RATE_8GT_BIT       0x08
 #define TS_DATA_RATE_CHANGE_AUTO   0x40
 #define TS_DATA_RATE_CHANGE_SPEED  0x80
 
@@ -217,6 +220,22 @@
 #define MSICAPTYPE                      0x05
 #define PCIECAPTYPE                     0x10
 
+// PCIe capability register offsets and device control fields
+#define CFG_PCIE_DEV_CTL_OFFSET         0x08
+#define CFG_PCIE_LINK_CTL_OFFSET        0x10
+
+#define DEV_CTL_MPS_BIT_POS             5
+#define DEV_CTL_MRRS_BIT_POS            12
+#define DEV_CTL_SIZE_MASK               0x7
+
+#define DEFAULT_MPS_BYTES               128
+#define DEFAULT_MRRS_BYTES              512
+#define MAX_MPS_BYTES                   4096
+
+#define LINK_CTL_RCB                    0x0008
+#define RCB_64_BYTES                    64
+#define RCB_128_BYTES                   128
+
 typedef struct  __attribute__ ((__packed__)) {
     uint16_t vendor_id;
     uint16_t device_id;
@@ -13,6 +13,11 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   2026.10    Added LTSSM ASPM configuration types
+//    10/2026   2026.10    Added 10-bit tag and completion field macros
+//    10/2026   2026.10    Added DLLP type and VC macros
+//    10/2026   2026.10    Fixed SET_TLP_TC to use 3 bit TC and added TC macro
+//    10/2026   2026.10    Added link utilisation monitor access functions
 //    09/2025   2026.01    Initial Version
 //
 //  This file is part of OSVVM.
@@ -152,6 +157,7 @@
 
 // Header field byte offsets
 #define DLLP_SEQ_OFFSET                   1
+#define DLLP_TYPE_OFFSET                  1
 #define TLP_TYPE_BYTE_OFFSET              3
 #define TLP_TC_BYTE_OFFSET                4
 #define TLP_TD_BYTE_OFFSET                5
@@ -243,6 +249,10 @@
 #define ENABLE_COMPLIANCE                 0x2
 #define ENABLE_LOOPBACK                   0x4
 
+// Tag value to request that the tag is allocated automatically. Negative,
+// so as not to clash with any valid 10-bit tag
+#define TLP_TAG_AUTO                      (-1)
+
 // -------------------------------------------------------------------------
 // Header field access macros
 // -------------------------------------------------------------------------
@@ -256,7 +266,7 @@
 }
 
 #define SET_TLP_TC(_TC, _PTR){  \
-    (_PTR)[TLP_TC_BYTE_OFFSET] = ((_PTR)[TLP_TC_BYTE_OFFSET] & 0x8f) | (((_TC) & 0x3)<<4);      \
+    (_PTR)[TLP_TC_BYTE_OFFSET] = ((_PTR)[TLP_TC_BYTE_OFFSET] & 0x8f) | (((_TC) & 0x7)<<4);      \
 }
 
 #define SET_TLP_TD(_TD, _PTR){  \
@@ -299,6 +309,11 @@
     (_PTR)[CPL_LOW_ADDR_OFFSET] = ((_ADDR) & 0x7f);    \
 }
 
+// Set the T9 and T8 bits of a 10-bit tag (byte 1 bits 7 and 3) for requests and completions
+#define SET_TAG10_HI(_TAG, _PTR){        \
+    (_PTR)[TLP_TC_BYTE_OFFSET] = ((_PTR)[TLP_TC_BYTE_OFFSET] & 0x77) | (((_TAG) >> 2) & 0x80) | (((_TAG) >> 5) & 0x08);    \
+}
+
 #define SET_DLLP_SEQ(_SEQ, _PTR){               \
     (_PTR)[DLLP_SEQ_OFFSET]   = ((_SEQ) >> 8) & LO_NIBBLE_MASK;    \
     (_PTR)[DLLP_SEQ_OFFSET+1] = (_SEQ) & BYTE_MASK;  \
@@ -378,6 +393,13 @@
                                   ((_PKT)[CPL_BYTE_COUNT_OFFSET+1] & BYTE_MASK))
 #define GET_CPL_STATUS(_PKT) (((_PKT)[CPL_STATUS_OFFSET] & 0xe0) >> 5)
 #define GET_CPL_CID(_PKT)     ((((_PKT)[CPL_CID_OFFSET] & BYTE_MASK) << 8) | (((_PKT)[CPL_CID_OFFSET+1] & BYTE_MASK)))
+#define GET_CPL_RID(_PKT)     ((((_PKT)[CPL_RID_OFFSET] & BYTE_MASK) << 8) | (((_PKT)[CPL_RID_OFFSET+1] & BYTE_MASK)))
+#define GET_CPL_LOW_ADDR(_PKT) ((_PKT)[CPL_LOW_ADDR_OFFSET] & 0x7f)
+#define GET_TLP_TC(_PKT)      (((_PKT)[TLP_TC_BYTE_OFFSET] >> 4) & 0x7)
+#define GET_DLLP_TYPE(_PKT)   ((_PKT)[DLLP_TYPE_OFFSET] & DL_VC_MASK)
+#define GET_DLLP_VC(_PKT)     ((_PKT)[DLLP_TYPE_OFFSET] & DL_VC_BITS)
+#define GET_TAG10_HI(_PKT)    (((((_PKT)[TLP_TC_BYTE_OFFSET] >> 7) & 0x1) << 9) | ((((_PKT)[TLP_TC_BYTE_OFFSET] >> 3) & 0x1) << 8))
+#define GET_CPL_TAG10(_PKT)   (GET_TAG10_HI(_PKT) | GET_CPL_TAG(_PKT))
 #define GET_CFG_CID(_PKT)     ((((_PKT)[CFG_BUS_OFFSET] & BYTE_MASK) << 8) | (((_PKT)[CFG_BUS_OFFSET+1] & BYTE_MASK)))
 
 #define DISCARD_PACKET(_PKT)  {free((_PKT)->data); free(_PKT);}
@@ -464,7 +486,13 @@ enum config_e {
     CONFIG_DISABLE_DISPLINK_COLOUR,
     CONFIG_ENABLE_DISPLINK_COLOUR,
 
-    CONFIG_DISP_BCK_NODE_NUM
+    CONFIG_DISP_BCK_NODE_NUM,
+
+    // Used if LTSSM present
+    CONFIG_LTSSM_GEN3_MODEL_ONLY,
+    CONFIG_LTSSM_ASPM_CTL,
+    CONFIG_LTSSM_ASPM_L0S_IDLE,
+    CONFIG_LTSSM_ASPM_L1_IDLE
 };
 
 typedef enum config_e config_t;
@@ -585,10 +613,43 @@ EXTERN void       getPcieVersionString    (char*          sbuf, const int bufsiz
 EXTERN void       SelectGen1Clock         (const int      node);
 EXTERN void       SelectGen2Clock         (const int      node);
 
+// Packet CRC regeneration, for use when altering a queued packet before it is sent
+EXTERN void       CalcEcrc                (PktData_t *data);
+EXTERN void       CalcLcrc                (PktData_t *data);
+
 # ifdef OSVVM
 EXTERN int        VWrite                  (unsigned int addr, unsigned int  data, int delta, unsigned int node);
 EXTERN int        VRead                   (unsigned int addr, unsigned int *data, int delta, unsigned int node);
 # endif
 
+// Link utilisation monitor. PcieModel's LINK_UTIL_* registers are accessed
+// directly, as the monitor is in the VHDL wrapper and not the model library.
+// The monitor must be enabled with PcieModel's LINK_UTIL_ENABLE (or
+// LINK_UTIL_FILE) generic.
+
+// Set the window length in cycles (0 for no windows), restarting all counts
+static inline void ConfigLinkUtil (const int window, const int node)
+{
+    VWrite(LINK_UTIL_WINDOW, window, 1, node);
+}
+
+// Return the symbol count for a direction (LINK_UTIL_TX or LINK_UTIL_RX),
+// lane and symbol class (LINK_UTIL_TLP, LINK_UTIL_DLLP, LINK_UTIL_OS,
+// LINK_UTIL_IDLE or LINK_UTIL_ELEC_IDLE), either since the counts were
+// restarted or for the last complete window
+static inline uint32_t ReadLinkUtil (const int dir, const int lane, const int type, const bool last_window, const int node)
+{
+    unsigned count;
+
+    VWrite(LINK_UTIL_SEL, ((last_window ? 1 : 0) << LINK_UTIL_SEL_WIN_BIT)  |
+                          ((dir  & 0x1)          << LINK_UTIL_SEL_DIR_BIT)  |
+                          ((lane & 0xf)          << LINK_UTIL_SEL_LANE_BIT) |
+                          ((type & 0xf)          << LINK_UTIL_SEL_TYPE_BIT), 1, node);
+
+    VRead(LINK_UTIL_COUNT, &count, 1, node);
+
+    return count;
+}
+
 #endif
 
@@ -0,0 +1,218 @@
+// =========================================================================
+//
+//  File Name:         pcieAckPolicy.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    Ack/Nak latency timer for the PCIe VC model C++ API. The timer
+//    period is the spec's Ack transmission latency limit for the max
+//    payload size, link width and data rate, and a single Ack DLLP is
+//    scheduled for all TLPs received within the period. Received
+//    sequence numbers are checked against NEXT_RCV_SEQ, with duplicate
+//    TLPs re-acknowledged and a single Nak scheduled until the next
+//    TLP in sequence. Ack DLLP overhead is accumulated.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Sequence number checking and NAK_SCHEDULED flag
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <cstdint>
+
+extern "C" {
+#include "pcie.h"
+}
+
+#ifndef _PCIEACKPOLICY_H_
+#define _PCIEACKPOLICY_H_
+
+// Ack latency timer calculation constants, in symbol times
+#define ACK_TLP_OVERHEAD                  28
+#define ACK_INTERNAL_DELAY_GEN1           19
+#define ACK_INTERNAL_DELAY_GEN2           70
+
+// Symbols per DLLP on the link, including framing
+#define DLLP_LINK_SYMBOLS                 8
+
+// DLL sequence number for NAKs with no TLP yet received
+#define ACK_NULL_SEQ                      0xfff
+
+#define ACK_SEQ_MASK                      0xfff
+#define ACK_SEQ_HALF_RANGE                2048
+
+// Received TLP sequence number status
+#define ACK_RX_GOOD                       0
+#define ACK_RX_DUPLICATE                  1
+#define ACK_RX_OUT_OF_SEQ                 2
+
+class pcieAckPolicy
+{
+public:
+               pcieAckPolicy           (void) : enabled(false), timer(0), pending(false), ackNow(false), firstRcvd(0), synced(false),
+                                                nextRcvSeq(0), nakScheduled(false), numTlps(0), numAcks(0), numNaks(0), numDuplicates(0)
+                                           {setLatency(DEFAULT_MPS_BYTES, 1, 1);};
+
+    // ---- Configuration ----
+
+    // NEXT_RCV_SEQ is taken from the first TLP received after enabling, as the
+    // policy may be enabled with the link already up
+    void       setEnabled              (const bool en)        {enabled = en; pending = ackNow = synced = nakScheduled = false;};
+    bool       isEnabled               (void)                 {return enabled;};
+
+    // Set the latency timer from the Ack transmission latency limit:
+    //   ((max payload + TLP overhead) * AckFactor / link width) + internal delay
+    // with AckFactor, scaled by 10, from the spec's table
+    void       setLatency              (const int mps, const int width, const int gen)
+    {
+        static const int widths[]         = {1,  2,  4,  8,  12, 16, 32};
+        static const int ackFactorSmall[] = {14, 14, 14, 25, 30, 30, 30};     // MPS of 128 and 256
+        static const int ackFactorLarge[] = {10, 10, 10, 10, 20, 20, 20};     // MPS of 512 upwards
+
+        int idx = 0;
+        while (idx < 6 && widths[idx] < width)
+        {
+            idx++;
+        }
+
+        int factor = (mps <= 256) ? ackFactorSmall[idx] : ackFactorLarge[idx];
+
+        timer = ((mps + ACK_TLP_OVERHEAD) * factor) / (10 * widths[idx]) +
+                ((gen > 1) ? ACK_INTERNAL_DELAY_GEN2 : ACK_INTERNAL_DELAY_GEN1);
+    };
+
+    void       setLatencyTimer         (const uint32_t cycles) {timer = cycles;};
+    uint32_t   getLatencyTimer         (void)                 {return timer;};
+
+    // ---- TLP acknowledgement ----
+
+    // Check the sequence number of a received TLP with a good LCRC against NEXT_RCV_SEQ.
+    // A TLP in sequence schedules its acknowledgement, starting the latency timer if no
+    // TLPs are already awaiting an Ack, and clears NAK_SCHEDULED. A duplicate of a TLP
+    // already received schedules an immediate Ack. Duplicate and out of sequence TLPs
+    // are to be discarded, with a Nak due (from getNak) for the latter.
+    int        rxTlp                   (const int seq, const uint32_t now)
+    {
+        if (!synced)
+        {
+            nextRcvSeq = seq & ACK_SEQ_MASK;
+            synced     = true;
+        }
+
+        int diff = (nextRcvSeq - seq) & ACK_SEQ_MASK;
+
+        if (diff == 0)
+        {
+            if (!pending)
+            {
+                firstRcvd = now;
+                pending   = true;
+            }
+
+            nextRcvSeq   = (nextRcvSeq + 1) & ACK_SEQ_MASK;
+            nakScheduled = false;
+            numTlps++;
+
+            return ACK_RX_GOOD;
+        }
+
+        if (diff <= ACK_SEQ_HALF_RANGE)
+        {
+            pending = ackNow = true;
+            numDuplicates++;
+
+            return ACK_RX_DUPLICATE;
+        }
+
+        return ACK_RX_OUT_OF_SEQ;
+    };
+
+    // Determine whether an Ack is due, returning true with the sequence number to acknowledge
+    bool       getAck                  (const uint32_t now, int &seq)
+    {
+        if (pending && (ackNow || (uint32_t)(now - firstRcvd) >= timer))
+        {
+            pending = ackNow = false;
+            seq     = lastSeq();
+            numAcks++;
+            return true;
+        }
+
+        return false;
+    };
+
+    // Determine whether a Nak is due for a bad or out of sequence TLP, returning true with
+    // the sequence number of the last good TLP if NAK_SCHEDULED was clear. The Nak also
+    // acknowledges the good TLPs, so any pending Ack is cancelled.
+    bool       getNak                  (int &seq)
+    {
+        if (nakScheduled)
+        {
+            return false;
+        }
+
+        nakScheduled = true;
+        pending      = ackNow = false;
+        seq          = lastSeq();
+        numNaks++;
+
+        return true;
+    };
+
+    bool       isNakScheduled          (void)                 {return nakScheduled;};
+    bool       isAckPending            (void)                 {return pending;};
+
+    // ---- Statistics ----
+
+    uint32_t   getNumTlps              (void)                 {return numTlps;};
+    uint32_t   getNumAcks              (void)                 {return numAcks;};
+    uint32_t   getNumNaks              (void)                 {return numNaks;};
+    uint32_t   getNumDuplicates        (void)                 {return numDuplicates;};
+    uint32_t   getAckOverhead          (void)                 {return (numAcks + numNaks) * DLLP_LINK_SYMBOLS;};
+
+    void       resetStats              (void)                 {numTlps = numAcks = numNaks = numDuplicates = 0;};
+
+private:
+    // Sequence number of the last good TLP received in sequence (ACK_NULL_SEQ when none)
+    int        lastSeq                 (void)                 {return (nextRcvSeq - 1) & ACK_SEQ_MASK;};
+
+    bool       enabled;
+    uint32_t   timer;
+
+    bool       pending;
+    bool       ackNow;
+    uint32_t   firstRcvd;
+
+    bool       synced;
+    int        nextRcvSeq;
+    bool       nakScheduled;
+
+    uint32_t   numTlps;
+    uint32_t   numAcks;
+    uint32_t   numNaks;
+    uint32_t   numDuplicates;
+};
+
+#endif
@@ -0,0 +1,315 @@
+// =========================================================================
+//
+//  File Name:         pcieCoSched.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    C++20 coroutine front end for the PCIe VC model C++ API. Many
+//    request streams, written as pcieCoTask coroutines, run on the one
+//    user thread of a node, suspending on co_await of a non-blocking
+//    memory read or a number of cycles. The node's scheduler resumes
+//    them from its cycle loop as reads complete and cycles elapse.
+//    Only available when compiled as C++20 with coroutine support.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <cstdint>
+#include <deque>
+#include <queue>
+#include <vector>
+#include <exception>
+#if __cplusplus >= 202002L
+#include <coroutine>
+#endif
+
+extern "C" {
+#include "pcie.h"
+}
+
+#ifndef _PCIECOSCHED_H_
+#define _PCIECOSCHED_H_
+
+#include "pcieModelClass.h"
+
+#if defined(__cpp_impl_coroutine) && defined(__cpp_lib_coroutine)
+
+class pcieCoSched;
+
+// -------------------------------------------------------------------------
+// Coroutine type of a request stream. A stream does not run until spawned
+// on a scheduler, which then owns it.
+// -------------------------------------------------------------------------
+
+class pcieCoTask
+{
+public:
+    struct promise_type
+    {
+        pcieCoTask          get_return_object   (void)                 {return pcieCoTask(std::coroutine_handle<promise_type>::from_promise(*this));};
+        std::suspend_always initial_suspend     (void) noexcept        {return {};};
+        std::suspend_always final_suspend       (void) noexcept        {return {};};
+        void                return_void         (void)                 {};
+        void                unhandled_exception (void)                 {std::terminate();};
+    };
+
+               pcieCoTask              (pcieCoTask &&other) noexcept : handle(other.handle) {other.handle = nullptr;};
+               pcieCoTask              (const pcieCoTask &)   = delete;
+    pcieCoTask& operator=              (const pcieCoTask &)   = delete;
+
+              ~pcieCoTask              ()                     {if (handle) handle.destroy();};
+
+private:
+    friend class pcieCoSched;
+
+    explicit   pcieCoTask              (std::coroutine_handle<promise_type> h) : handle(h) {};
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+// -------------------------------------------------------------------------
+// Per node scheduler. The model's receive callback must be installed with
+// initialisePcie() (or one of its alternatives) for read completions to be
+// matched.
+// -------------------------------------------------------------------------
+
+class pcieCoSched
+{
+public:
+    // Awaitable for a number of cycles
+    struct cycleAwaiter
+    {
+        pcieCoSched* sched;
+        uint32_t     cycles;
+
+        bool       await_ready             (void)                 {return cycles == 0;};
+        void       await_suspend           (std::coroutine_handle<> h) {sched->sleep(h, cycles);};
+        void       await_resume            (void)                 {};
+    };
+
+    // Awaitable for a memory read, resuming with true if it completed successfully.
+    // The request handle is held in the awaiter, which lives in the coroutine frame
+    // for as long as the read is outstanding.
+    struct readAwaiter
+    {
+        pcieCoSched*  sched;
+        uint64_t      addr;
+        PktData_t*    buf;
+        int           length;
+        uint32_t      rid;
+        pcieRequest_t req;
+
+        bool       await_ready             (void)                 {return false;};
+        void       await_suspend           (std::coroutine_handle<> h) {sched->read(this, h);};
+        bool       await_resume            (void)                 {return req.state == PCIE_REQ_COMPLETE && req.cplStatus == CPL_SUCCESS;};
+    };
+
+               pcieCoSched             (pcieModelClass* modelIn) : model(modelIn), seq(0) {};
+
+              ~pcieCoSched             ()
+                                           {
+                                               for (size_t idx = 0; idx < tasks.size(); idx++)
+                                               {
+                                                   tasks[idx].destroy();
+                                               }
+                                           };
+
+    // ---- Awaitables ----
+
+    cycleAwaiter waitCycles            (const uint32_t cycles) {return cycleAwaiter{this, cycles};};
+
+    readAwaiter  memReadAsync          (const uint64_t addr, PktData_t* buf, const int length, const uint32_t rid)
+                                                              {return readAwaiter{this, addr, buf, length, rid, pcieRequest_t()};};
+
+    // ---- Scheduling ----
+
+    // Take ownership of a stream, which first runs on the next call to step() or run()
+    void       spawn                   (pcieCoTask &&task)
+    {
+        tasks.push_back(task.handle);
+        ready.push_back(task.handle);
+        task.handle = nullptr;
+    };
+
+    int        getNumTasks             (void)                 {return (int)tasks.size();};
+
+    // Resume all runnable streams, then advance the model until at least one stream is
+    // runnable again. When only waiting on cycles, the model idles to the earliest wake up
+    // in a single call.
+    void       step                    (void)
+    {
+        while (!ready.empty())
+        {
+            std::coroutine_handle<> h = ready.front();
+            ready.pop_front();
+
+            h.resume();
+
+            if (h.done())
+            {
+                finish(h);
+            }
+        }
+
+        while (ready.empty() && !tasks.empty())
+        {
+            issueBlocked();
+
+            uint32_t now   = model->getCycleCount();
+            int      ticks = 1;
+
+            if (reads.empty() && blocked.empty() && !sleepers.empty())
+            {
+                int32_t delta = (int32_t)(sleepers.top().wake - now);
+                ticks         = (delta > 1) ? delta : 1;
+            }
+
+            model->sendIdle(ticks);
+            model->checkTimeouts();
+
+            wake(model->getCycleCount());
+        }
+    };
+
+    // Run until all streams have finished
+    void       run                     (void)
+    {
+        while (!tasks.empty())
+        {
+            step();
+        }
+    };
+
+private:
+
+    typedef struct {
+        readAwaiter*            aw;
+        std::coroutine_handle<> h;
+    } read_t;
+
+    typedef struct {
+        uint32_t                wake;
+        uint64_t                seq;
+        std::coroutine_handle<> h;
+    } sleeper_t;
+
+    // Orders the sleepers' heap by wake up cycle, and in order of suspension for equal cycles
+    struct laterWake
+    {
+        bool operator()        (const sleeper_t &a, const sleeper_t &b) const
+        {
+            int32_t diff = (int32_t)(a.wake - b.wake);
+            return diff > 0 || (diff == 0 && a.seq > b.seq);
+        };
+    };
+
+    void       sleep                   (std::coroutine_handle<> h, const uint32_t cycles)
+    {
+        sleepers.push(sleeper_t{model->getCycleCount() + cycles, seq++, h});
+    };
+
+    // Issue a read if a tag is free and no earlier read is waiting for one
+    void       read                    (readAwaiter* aw, std::coroutine_handle<> h)
+    {
+        if (!blocked.empty() || !issue(aw, h))
+        {
+            blocked.push_back(read_t{aw, h});
+        }
+    };
+
+    bool       issue                   (readAwaiter* aw, std::coroutine_handle<> h)
+    {
+        if (!model->canIssue() || model->memReadAsync(aw->addr, aw->buf, aw->length, aw->rid, &aw->req) < 0)
+        {
+            return false;
+        }
+
+        reads.push_back(read_t{aw, h});
+
+        return true;
+    };
+
+    void       issueBlocked            (void)
+    {
+        while (!blocked.empty() && issue(blocked.front().aw, blocked.front().h))
+        {
+            blocked.pop_front();
+        }
+    };
+
+    // Make runnable the streams whose reads have finished or whose cycles have elapsed
+    void       wake                    (const uint32_t now)
+    {
+        for (size_t idx = 0; idx < reads.size(); )
+        {
+            if (reads[idx].aw->req.state != PCIE_REQ_PENDING)
+            {
+                ready.push_back(reads[idx].h);
+                reads[idx] = reads.back();
+                reads.pop_back();
+            }
+            else
+            {
+                idx++;
+            }
+        }
+
+        while (!sleepers.empty() && (int32_t)(now - sleepers.top().wake) >= 0)
+        {
+            ready.push_back(sleepers.top().h);
+            sleepers.pop();
+        }
+    };
+
+    void       finish                  (std::coroutine_handle<> h)
+    {
+        for (size_t idx = 0; idx < tasks.size(); idx++)
+        {
+            if (tasks[idx] == h)
+            {
+                tasks[idx] = tasks.back();
+                tasks.pop_back();
+                break;
+            }
+        }
+
+        h.destroy();
+    };
+
+    pcieModelClass*                                                  model;
+    uint64_t                                                         seq;
+
+    std::vector<std::coroutine_handle<> >                            tasks;
+    std::deque<std::coroutine_handle<> >                             ready;
+    std::vector<read_t>                                              reads;
+    std::deque<read_t>                                               blocked;
+    std::priority_queue<sleeper_t, std::vector<sleeper_t>, laterWake> sleepers;
+};
+
+#endif
+
+#endif
@@ -0,0 +1,340 @@
+// =========================================================================
+//
+//  File Name:         pcieFcPolicy.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    Receive flow control credit return policy for the PCIe VC model C++
+//    API. Credits consumed by received TLPs are returned to the link
+//    partner in UpdateFC DLLPs either immediately, on reaching a credit
+//    threshold, on the flow control update timer or coalesced over idle
+//    periods. The cycles that each credit type spends with no credits
+//    available to the link partner are accumulated. As the policies
+//    disable the model's flow control, transmit credits advertised by the
+//    link partner are also tracked, for the model class to check.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <cstdint>
+
+extern "C" {
+#include "pcie.h"
+}
+
+#ifndef _PCIEFCPOLICY_H_
+#define _PCIEFCPOLICY_H_
+
+// UpdateFC policies
+#define PCIE_FC_POLICY_MODEL              0         // Model's internal consumption rate based updates
+#define PCIE_FC_POLICY_IMMEDIATE          1
+#define PCIE_FC_POLICY_THRESHOLD          2
+#define PCIE_FC_POLICY_TIMER              3
+#define PCIE_FC_POLICY_COALESCED          4
+
+// Default idle cycles before coalesced credits are returned
+#define PCIE_FC_DEFAULT_COALESCE          64
+
+#define FC_HDR_CREDIT_MASK                0xff
+#define FC_DATA_CREDIT_MASK               0xfff
+
+class pcieFcPolicy
+{
+public:
+               pcieFcPolicy            (void) : policy(PCIE_FC_POLICY_MODEL), timer(DEFAULT_FC_TIME), coalesce(PCIE_FC_DEFAULT_COALESCE)
+                                           {
+                                               setInitCredits(FC_POST,    FC_DEFAULT_PHDR_CREDITS,   FC_DEFAULT_PDATA_CREDITS);
+                                               setInitCredits(FC_NONPOST, FC_DEFAULT_NPHDR_CREDITS,  FC_DEFAULT_NPDATA_CREDITS);
+                                               setInitCredits(FC_CMPL,    FC_DEFAULT_CPLHDR_CREDITS, FC_DEFAULT_CPLDATA_CREDITS);
+                                               reset(0);
+
+                                               for (int type = 0; type < FC_NUMTYPES; type++)
+                                               {
+                                                   tx[type].init     = false;
+                                                   tx[type].consHdr  = 0;
+                                                   tx[type].consData = 0;
+                                               }
+                                           };
+
+    // ---- Configuration ----
+
+    void       setPolicy               (const int pol)        {policy = pol;};
+    int        getPolicy               (void)                 {return policy;};
+
+    void       setTimer                (const uint32_t cycles) {timer    = cycles;};
+    void       setCoalesce             (const uint32_t cycles) {coalesce = cycles;};
+
+    // Credits advertised at initialisation (0 for infinite). The return thresholds
+    // default to half the initial credits.
+    void       setInitCredits          (const int type, const uint32_t hdr, const uint32_t data)
+    {
+        fc[type].initHdr    = hdr;
+        fc[type].initData   = data;
+        fc[type].threshHdr  = (hdr  + 1) / 2;
+        fc[type].threshData = (data + 1) / 2;
+    };
+
+    uint32_t   getInitHdr              (const int type)       {return fc[type].initHdr;};
+    uint32_t   getInitData             (const int type)       {return fc[type].initData;};
+
+    void       setThreshold            (const int type, const uint32_t hdr, const uint32_t data)
+    {
+        fc[type].threshHdr  = hdr  ? hdr  : 1;
+        fc[type].threshData = data ? data : 1;
+    };
+
+    // Restart credit accounting, as at flow control initialisation
+    void       reset                   (const uint32_t now)
+    {
+        for (int type = 0; type < FC_NUMTYPES; type++)
+        {
+            fc[type].rcvdHdr    = 0;
+            fc[type].rcvdData   = 0;
+            fc[type].retHdr     = 0;
+            fc[type].retData    = 0;
+            fc[type].lastRcvd   = now;
+            fc[type].lastUpdate = now;
+            fc[type].zeroSince  = now;
+            fc[type].zeroCycles = 0;
+            fc[type].numUpdates = 0;
+            fc[type].isZero     = false;
+        }
+    };
+
+    // ---- Credit accounting ----
+
+    // Flow control type of a TLP: completions, then messages and memory writes
+    // as posted, with all else non-posted
+    static int fcType                  (const PktData_t* pkt)
+    {
+        int type5 = GET_TLP_TYPE(pkt) & 0x1f;
+
+        return ((type5 & 0x1e) == TL_CPL)                                                      ? FC_CMPL :
+               ((type5 & 0x18) == 0x10 || (type5 == 0 && (GET_TLP_TYPE(pkt) & TL_TYPE_WRITE))) ? FC_POST : FC_NONPOST;
+    };
+
+    // Data credits for a payload of the given number of bytes
+    static uint32_t dataCredits        (const int bytes)      {return (bytes + FC_DATA_CREDIT_BYTES - 1) / FC_DATA_CREDIT_BYTES;};
+
+    // Data credits consumed by a TLP
+    static uint32_t fcDataCredits      (const PktData_t* pkt)
+    {
+        return (GET_TLP_TYPE(pkt) & TL_TYPE_WRITE) ? dataCredits(GET_TLP_LENGTH(pkt) * 4) : 0;
+    };
+
+    // Account for the credits of a received TLP, which are freed on reception
+    void       rxTlp                   (const PktData_t* pkt, const uint32_t now)
+    {
+        fcState_t* s = &fc[fcType(pkt)];
+
+        s->rcvdHdr++;
+        s->rcvdData += fcDataCredits(pkt);
+        s->lastRcvd  = now;
+
+        checkZero(s, now);
+    };
+
+    // Determine whether an UpdateFC is due for the credit type, returning true with
+    // the credit limits to advertise if so
+    bool       getUpdate               (const int type, const uint32_t now, uint32_t &hdrfc, uint32_t &datafc)
+    {
+        fcState_t* s       = &fc[type];
+        uint32_t   pendHdr = s->rcvdHdr  - s->retHdr;
+        uint32_t   pendDat = s->rcvdData - s->retData;
+        bool       pending = (s->initHdr && pendHdr) || (s->initData && pendDat);
+        bool       timeout = (uint32_t)(now - s->lastUpdate) >= timer;
+        bool       send;
+
+        // Infinite credits for both header and data need no updates
+        if (s->initHdr == FC_INFINITE_CREDITS && s->initData == FC_INFINITE_CREDITS)
+        {
+            return false;
+        }
+
+        switch (policy)
+        {
+        case PCIE_FC_POLICY_IMMEDIATE:
+            send = pending || timeout;
+            break;
+        case PCIE_FC_POLICY_THRESHOLD:
+            send = (s->initHdr  && pendHdr >= s->threshHdr) ||
+                   (s->initData && pendDat >= s->threshData) || timeout;
+            break;
+        case PCIE_FC_POLICY_COALESCED:
+            send = (pending && ((uint32_t)(now - s->lastRcvd) >= coalesce ||
+                                (s->initHdr  && pendHdr >= s->threshHdr)  ||
+                                (s->initData && pendDat >= s->threshData))) || timeout;
+            break;
+        case PCIE_FC_POLICY_TIMER:
+            send = timeout;
+            break;
+        default:
+            send = false;
+            break;
+        }
+
+        if (send)
+        {
+            s->retHdr     = s->rcvdHdr;
+            s->retData    = s->rcvdData;
+            s->lastUpdate = now;
+            s->numUpdates++;
+
+            hdrfc         = s->initHdr  ? (s->initHdr  + s->retHdr)  & FC_HDR_CREDIT_MASK  : FC_INFINITE_CREDITS;
+            datafc        = s->initData ? (s->initData + s->retData) & FC_DATA_CREDIT_MASK : FC_INFINITE_CREDITS;
+
+            checkZero(s, now);
+        }
+
+        return send;
+    };
+
+    // ---- Transmit credits ----
+
+    // Process a received VC0 flow control DLLP. The first InitFC of each type gives the
+    // link partner's initial credit limits, which its UpdateFCs then advance.
+    void       txFcDllp                (const PktData_t* pkt)
+    {
+        int type   = GET_DLLP_TYPE(pkt);
+        int kind   = type & 0xc0;                        // InitFC1, InitFC2 or UpdateFC
+        int fctype = (type >> 4) & 0x3;
+
+        if (GET_DLLP_VC(pkt) != 0 || kind == 0 || fctype >= FC_NUMTYPES)
+        {
+            return;
+        }
+
+        txState_t* s = &tx[fctype];
+
+        if (!s->init)
+        {
+            if (kind == (DL_UPDATEFC_P & 0xc0))
+            {
+                return;
+            }
+
+            s->init    = true;
+            s->infHdr  = GET_HDR_FC(pkt)  == FC_INFINITE_CREDITS;
+            s->infData = GET_DATA_FC(pkt) == FC_INFINITE_CREDITS;
+        }
+
+        s->limitHdr  = GET_HDR_FC(pkt);
+        s->limitData = GET_DATA_FC(pkt);
+    };
+
+    // Check the link partner has the credits for a TLP, using the modulo credit arithmetic
+    // of the spec. The model checks its own transmit credits under PCIE_FC_POLICY_MODEL,
+    // and none are checked before the link partner's InitFCs are seen.
+    bool       txHasCredits            (const int type, const uint32_t hdr, const uint32_t data)
+    {
+        txState_t* s = &tx[type];
+
+        if (policy == PCIE_FC_POLICY_MODEL || !s->init)
+        {
+            return true;
+        }
+
+        bool hdrOk  = s->infHdr  || ((s->limitHdr  - (s->consHdr  + hdr))  & FC_HDR_CREDIT_MASK)  <= (FC_HDR_CREDIT_MASK  + 1) / 2;
+        bool dataOk = s->infData || ((s->limitData - (s->consData + data)) & FC_DATA_CREDIT_MASK) <= (FC_DATA_CREDIT_MASK + 1) / 2;
+
+        return hdrOk && dataOk;
+    };
+
+    // Credits consumed by transmitted TLPs are counted under all policies, so that a policy
+    // can be changed after flow control initialisation
+    void       txConsume               (const int type, const uint32_t hdr, const uint32_t data)
+    {
+        tx[type].consHdr  += hdr;
+        tx[type].consData += data;
+    };
+
+    // ---- Statistics ----
+
+    // Cycles the credit type has spent with no header or data credits available to the link partner
+    uint32_t   getZeroCreditCycles     (const int type, const uint32_t now)
+    {
+        return fc[type].zeroCycles + (fc[type].isZero ? now - fc[type].zeroSince : 0);
+    };
+
+    uint32_t   getNumUpdates           (const int type)       {return fc[type].numUpdates;};
+
+private:
+
+    typedef struct {
+        uint32_t initHdr;
+        uint32_t initData;
+        uint32_t threshHdr;
+        uint32_t threshData;
+        uint32_t rcvdHdr;            // Credits consumed by received TLPs
+        uint32_t rcvdData;
+        uint32_t retHdr;             // Credits returned in UpdateFCs
+        uint32_t retData;
+        uint32_t lastRcvd;
+        uint32_t lastUpdate;
+        uint32_t zeroSince;
+        uint32_t zeroCycles;
+        uint32_t numUpdates;
+        bool     isZero;
+    } fcState_t;
+
+    typedef struct {
+        bool     init;
+        bool     infHdr;
+        bool     infData;
+        uint32_t limitHdr;           // Link partner's advertised credit limits
+        uint32_t limitData;
+        uint32_t consHdr;            // Credits consumed by transmitted TLPs
+        uint32_t consData;
+    } txState_t;
+
+    // Update zero credit accounting on a change of available credits
+    void       checkZero               (fcState_t* s, const uint32_t now)
+    {
+        bool zero = (s->initHdr  && s->rcvdHdr  - s->retHdr  >= s->initHdr) ||
+                    (s->initData && s->rcvdData - s->retData >= s->initData);
+
+        if (zero && !s->isZero)
+        {
+            s->zeroSince   = now;
+        }
+        else if (!zero && s->isZero)
+        {
+            s->zeroCycles += now - s->zeroSince;
+        }
+
+        s->isZero = zero;
+    };
+
+    int        policy;
+    uint32_t   timer;
+    uint32_t   coalesce;
+
+    fcState_t  fc[FC_NUMTYPES];
+    txState_t  tx[FC_NUMTYPES];
+};
+
+#endif
@@ -0,0 +1,218 @@
+// =========================================================================
+//
+//  File Name:         pcieLatencyStats.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    Request to completion latency histograms for the PCIe VC model C++
+//    API, kept per request type. Latencies, in cycles, are binned in
+//    log-linear buckets (eight per power of two above 16 cycles, so within
+//    12.5%), giving min, max, mean and percentiles in fixed memory.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <cstdint>
+#include <cstdio>
+#include <cmath>
+
+#ifndef _PCIELATENCYSTATS_H_
+#define _PCIELATENCYSTATS_H_
+
+// Request types for latency statistics
+#define PCIE_LAT_MEM_RD                   0
+#define PCIE_LAT_CFG_RD                   1
+#define PCIE_LAT_IO_RD                    2
+#define PCIE_LAT_NUM_TYPES                3
+
+// Histogram buckets, being 16 single cycle buckets, then 8 per power of two
+#define PCIE_LAT_LINEAR_BUCKETS           16
+#define PCIE_LAT_SUB_BITS                 3
+#define PCIE_LAT_SUB_BUCKETS              (1 << PCIE_LAT_SUB_BITS)
+#define PCIE_LAT_NUM_BUCKETS              (PCIE_LAT_SUB_BUCKETS * (32 - PCIE_LAT_SUB_BITS + 1))
+
+class pcieLatencyStats
+{
+public:
+               pcieLatencyStats        (void)                 {reset();};
+
+    // ---- Recording ----
+
+    void       record                  (const int type, const uint32_t latency)
+    {
+        hist_t* h = &hist[type];
+
+        h->bucket[bucketIdx(latency)]++;
+        h->count++;
+        h->sum += latency;
+
+        if (latency < h->min) h->min = latency;
+        if (latency > h->max) h->max = latency;
+    };
+
+    void       reset                   (const int type)
+    {
+        for (int idx = 0; idx < PCIE_LAT_NUM_BUCKETS; idx++)
+        {
+            hist[type].bucket[idx] = 0;
+        }
+
+        hist[type].count = 0;
+        hist[type].sum   = 0;
+        hist[type].min   = UINT32_MAX;
+        hist[type].max   = 0;
+    };
+
+    void       reset                   (void)
+    {
+        for (int type = 0; type < PCIE_LAT_NUM_TYPES; type++)
+        {
+            reset(type);
+        }
+    };
+
+    // ---- Statistics ----
+
+    uint32_t   getCount                (const int type)       {return hist[type].count;};
+    uint32_t   getMin                  (const int type)       {return hist[type].count ? hist[type].min : 0;};
+    uint32_t   getMax                  (const int type)       {return hist[type].max;};
+    double     getMean                 (const int type)       {return hist[type].count ? (double)hist[type].sum / hist[type].count : 0.0;};
+
+    // Latency at or below which the given percentage of requests completed, to the
+    // upper limit of the bucket the percentile falls in
+    uint32_t   getPercentile           (const int type, const double pct)
+    {
+        hist_t*  h      = &hist[type];
+        uint64_t target = (uint64_t)ceil(pct * h->count / 100.0);
+        uint64_t sum    = 0;
+
+        if (h->count == 0)
+        {
+            return 0;
+        }
+
+        for (int idx = 0; idx < PCIE_LAT_NUM_BUCKETS; idx++)
+        {
+            sum += h->bucket[idx];
+
+            if (sum >= target && sum)
+            {
+                uint32_t upper = bucketUpper(idx);
+                return upper < h->max ? upper : h->max;
+            }
+        }
+
+        return h->max;
+    };
+
+    // ---- Output ----
+
+    // Write a summary line per request type, as CSV or JSON
+    void       dump                    (FILE* fp, const bool json = false)
+    {
+        static const char* names[PCIE_LAT_NUM_TYPES] = {"MemRd", "CfgRd", "IoRd"};
+
+        if (json)
+        {
+            fprintf(fp, "[\n");
+        }
+        else
+        {
+            fprintf(fp, "type,count,min,mean,p50,p90,p99,p999,max\n");
+        }
+
+        for (int type = 0; type < PCIE_LAT_NUM_TYPES; type++)
+        {
+            fprintf(fp, json ? "  {\"type\": \"%s\", \"count\": %u, \"min\": %u, \"mean\": %.2f, \"p50\": %u, \"p90\": %u, \"p99\": %u, \"p999\": %u, \"max\": %u}%s\n"
+                             : "%s,%u,%u,%.2f,%u,%u,%u,%u,%u%s\n",
+                        names[type], getCount(type), getMin(type), getMean(type),
+                        getPercentile(type, 50.0), getPercentile(type, 90.0), getPercentile(type, 99.0), getPercentile(type, 99.9),
+                        getMax(type), (json && type < PCIE_LAT_NUM_TYPES-1) ? "," : "");
+        }
+
+        if (json)
+        {
+            fprintf(fp, "]\n");
+        }
+    };
+
+    bool       dump                    (const char* filename, const bool json = false)
+    {
+        FILE* fp = fopen(filename, "w");
+
+        if (fp == NULL)
+        {
+            return false;
+        }
+
+        dump(fp, json);
+        fclose(fp);
+
+        return true;
+    };
+
+private:
+
+    typedef struct {
+        uint32_t bucket[PCIE_LAT_NUM_BUCKETS];
+        uint32_t count;
+        uint64_t sum;
+        uint32_t min;
+        uint32_t max;
+    } hist_t;
+
+    // Bucket index of a latency: linear below 16, and then the top four
+    // significant bits select the power of two and the sub-bucket
+    int        bucketIdx               (const uint32_t latency)
+    {
+        if (latency < PCIE_LAT_LINEAR_BUCKETS)
+        {
+            return latency;
+        }
+
+        int msb   = 31 - __builtin_clz(latency);
+        int shift = msb - PCIE_LAT_SUB_BITS;
+
+        return (shift + 1) * PCIE_LAT_SUB_BUCKETS + (int)((latency >> shift) - PCIE_LAT_SUB_BUCKETS);
+    };
+
+    uint32_t   bucketUpper             (const int idx)
+    {
+        if (idx < PCIE_LAT_LINEAR_BUCKETS)
+        {
+            return idx;
+        }
+
+        int shift = idx / PCIE_LAT_SUB_BUCKETS - 1;
+
+        return (uint32_t)((((uint64_t)(PCIE_LAT_SUB_BUCKETS + idx % PCIE_LAT_SUB_BUCKETS + 1)) << shift) - 1);
+    };
+
+    hist_t     hist[PCIE_LAT_NUM_TYPES];
+};
+
+#endif
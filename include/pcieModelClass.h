@@ -13,6 +13,23 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   2026.10    Added non-blocking requests with tag table
+//    10/2026   2026.10    Added MPS/MRRS split burst transfers
+//    10/2026   2026.10    Added RCB aware memory completer
+//    10/2026   2026.10    Added UpdateFC policies and zero credit accounting
+//    10/2026   2026.10    Added Ack/Nak latency timer with Ack coalescing
+//    10/2026   2026.10    Added virtual channels with TC/VC mapping and arbitration
+//    10/2026   2026.10    Added request to completion latency statistics
+//    10/2026   2026.10    Added link utilisation monitor access
+//    10/2026   2026.10    Added request tag availability check
+//    10/2026   2026.10    Added shadow memory read data checking
+//    10/2026   2026.10    Added node number access
+//    10/2026   2026.10    Added batched receive callback
+//    10/2026   2026.10    Added pre-parsed received TLP headers
+//    10/2026   2026.10    Added owning packet handle receive callback
+//    10/2026   2026.10    Explicit lambda captures for C++20 builds
+//    10/2026   2026.10    Added ASPM policy and statistics access
+//    10/2026   2026.10    Added counter based random streams
 //    09/2025   2026.01    Initial Version
 //
 //  This file is part of OSVVM.
@@ -34,6 +51,7 @@
 // =========================================================================
 
 #include <cstdint>
+#include <vector>
 
 extern "C" {
 #include "pcie.h"
@@ -45,94 +63,130 @@ extern "C" {
 #ifndef _PCIEMODELCLASS_H_
 #define _PCIEMODELCLASS_H_
 
+#include "pcieReqTracker.h"
+#include "pcieFcPolicy.h"
+#include "pcieAckPolicy.h"
+#include "pcieVcArbiter.h"
+#include "pcieShadowMem.h"
+#include "pcieTlpHdr.h"
+#include "pcieTlp.h"
+#include "pcieRng.h"
+
+// Memory completer read completion split policies
+#define PCIE_CPL_SPLIT_OFF                0
+#define PCIE_CPL_SPLIT_MPS                1
+#define PCIE_CPL_SPLIT_RCB                2
+#define PCIE_CPL_SPLIT_RANDOM             3
+
+// Read-only view of a received packet passed to a batch receive callback,
+// valid only for the duration of the call
+typedef struct {
+    const PktData_t* data;
+    int              seq;
+    int              status;
+    uint32_t         timeStamp;
+    uint32_t         byteCount;
+    pcieTlpHdr_t     hdr;            // Decoded header of TLPs (zero for DLLPs)
+} pcieRxView_t;
+
+typedef void (*batch_callback_t)(const pcieRxView_t* pkts, const int count, void* usrptr);
+
+// Receive callback passed ownership of each packet in a move-only handle
+typedef void (*tlp_callback_t)(pcieTlp &&tlp, void* usrptr);
+
 class pcieModelClass
 {
 public:
-               pcieModelClass          (const unsigned nodeIn) : node (nodeIn) {};
+               pcieModelClass          (const unsigned nodeIn) : node (nodeIn), userCb(NULL), userPtr(NULL), batchCb(NULL), batchPtr(NULL),
+                                                batchSize(0), inFlush(false), tlpCb(NULL), tlpPtr(NULL), cplPolicy(PCIE_CPL_SPLIT_OFF), cplRcb(RCB_64_BYTES),
+                                                cplMps(DEFAULT_MPS_BYTES), cplCid(0), cplDelay(false), txPending(false), txCplHdr(0), txCplData(0),
+                                                rngSeedVal(PCIE_RNG_DEFAULT_SEED), arb(&fc), vcInitTime(0)
+                                                {PcieRngInit(&cplRng, rngSeedVal, PCIE_RNG_STREAM_ID(PCIE_RNG_STREAM_CPL, nodeIn));};
 
-    // TLP generation
+    // TLP generation. Under an UpdateFC policy other than PCIE_FC_POLICY_MODEL, these wait
+    // for the link partner's VC0 credits, which the model then no longer checks.
     pPktData_t memWrite                (const uint64_t addr, const PktData_t *data, const int length, const int tag,
                                         const uint32_t rid, const bool queue = false, const bool digest = false)
-                                           {return MemWriteDigest(addr, data, length, tag, rid, digest, queue, node);};
+                                           {txCredits(FC_POST, length); shadowWrite(addr, data, length); return MemWriteDigest(addr, data, length, tag, rid, digest, queue, node);};
 
     pPktData_t memRead                 (const uint64_t addr, const int length, const int tag, const uint32_t rid, const bool queue = false, const bool digest = false, const bool lock = false)
-                                           {return MemReadLockDigest(addr, length, tag, rid, lock, digest, queue, node);};
+                                           {txCredits(FC_NONPOST); return MemReadLockDigest(addr, length, tag, rid, lock, digest, queue, node);};
 
     pPktData_t completion              (const uint64_t addr, const PktData_t *data, const int status, const int fbe, const int lbe, const int length,
                                         const int tag, const uint32_t cid, const uint32_t rid, const bool queue = false, const bool digest = false)
-                                           {return CompletionDigest(addr, data, status, fbe, lbe, length, tag, cid, rid, digest, queue, node);};
+                                           {txCredits(FC_CMPL, data ? length * 4 : 0); return CompletionDigest(addr, data, status, fbe, lbe, length, tag, cid, rid, digest, queue, node);};
 
     pPktData_t partCompletion          (const uint64_t addr, const PktData_t *data, const int status, const int fbe, const int lbe, const int rlength,
                                         const int length, const int tag, const uint32_t cid, const uint32_t rid, const bool queue = false, const bool digest = false)
-                                           {return PartCompletionDigest(addr, data, status, fbe, lbe, rlength, length, tag, cid, rid, digest, queue, node);};
+                                           {txCredits(FC_CMPL, data ? length * 4 : 0); return PartCompletionDigest(addr, data, status, fbe, lbe, rlength, length, tag, cid, rid, digest, queue, node);};
 
     pPktData_t completionDelay         (const uint64_t addr, const PktData_t *data, const int status, const int fbe, const int lbe, const int length,
                                         const int tag, const uint32_t cid, const uint32_t rid)
-                                           {return CompletionDelay(addr, data, status, fbe, lbe, length, tag, cid, rid, node);};
+                                           {txCredits(FC_CMPL, data ? length * 4 : 0); return CompletionDelay(addr, data, status, fbe, lbe, length, tag, cid, rid, node);};
 
     pPktData_t partCompletionDelay     (const uint64_t addr, const PktData_t *data, const int status, const int fbe, const int lbe, const int rlength,
                                         const int length, const int tag, const uint32_t cid, const uint32_t rid, const bool digest, const bool delay,
                                         const bool queue)
-                                           {return PartCompletionDelay(addr, data, status, fbe, lbe, rlength, length, tag, cid, rid, digest, delay, queue, node);};
+                                           {txCredits(FC_CMPL, data ? length * 4 : 0); return PartCompletionDelay(addr, data, status, fbe, lbe, rlength, length, tag, cid, rid, digest, delay, queue, node);};
 
     pPktData_t cfgWrite                (const uint64_t addr, const PktData_t *data, const int length, const int tag, const uint32_t rid, const bool queue = false, const bool digest = false)
-                                           {return CfgWriteDigest(addr, data, length, tag, rid, digest, queue, node);};
+                                           {txCredits(FC_NONPOST, length); return CfgWriteDigest(addr, data, length, tag, rid, digest, queue, node);};
 
     pPktData_t cfgRead                 (const uint64_t addr, const int length, const int tag, const uint32_t rid, const bool queue = false, const bool digest = false)
-                                           {return CfgReadDigest(addr, length, tag, rid, digest, queue, node);};
+                                           {txCredits(FC_NONPOST); return CfgReadDigest(addr, length, tag, rid, digest, queue, node);};
 
     pPktData_t ioWrite                 (const uint64_t addr, const PktData_t *data, const int length, const int tag, const uint32_t rid,
                                         const bool queue = false, const bool digest = false)
-                                           {return IoWriteDigest(addr, data, length, tag, rid, digest, queue, node);};
+                                           {txCredits(FC_NONPOST, length); return IoWriteDigest(addr, data, length, tag, rid, digest, queue, node);};
 
     pPktData_t ioRead                  (const uint64_t addr, const int length, const int tag, const uint32_t rid, const bool queue = false, const bool digest = false)
-                                           {return IoReadDigest(addr, length, tag, rid, digest, queue, node);};
+                                           {txCredits(FC_NONPOST); return IoReadDigest(addr, length, tag, rid, digest, queue, node);};
 
     pPktData_t message                 (const int code, const PktData_t *data, const int length, const int tag, const uint32_t rid, const uint64_t vend_data,
                                         const bool queue = false, const bool digest = false)
-                                           {return MessageVendorDigest(code, data, length, tag, rid, vend_data, digest, queue, node);};
+                                           {txCredits(FC_POST, length); return MessageVendorDigest(code, data, length, tag, rid, vend_data, digest, queue, node);};
 
     // TLP variant with digest (ECRC ) generation argument
     pPktData_t memWriteDigest          (const uint64_t addr, const PktData_t *data, const int length, const int tag, const uint32_t rid, const bool digest = true,
                                         const bool queue = false)
-                                           {return MemWriteDigest(addr, data, length, tag, rid, digest, queue, node);};
+                                           {txCredits(FC_POST, length); shadowWrite(addr, data, length); return MemWriteDigest(addr, data, length, tag, rid, digest, queue, node);};
 
     pPktData_t memReadDigest           (const uint64_t addr, const int length, const int tag, const uint32_t rid, const bool digest = true, const bool queue = false)
-                                           {return MemReadDigest(addr, length, tag, rid, digest, queue, node);};
+                                           {txCredits(FC_NONPOST); return MemReadDigest(addr, length, tag, rid, digest, queue, node);};
 
     pPktData_t memReadLockDigest       (const uint64_t addr, const int length, const int tag, const uint32_t rid, const bool lock, const bool digest = true, const bool queue = false)
-                                           {return MemReadLockDigest(addr, length, tag, rid, lock, digest, queue, node);};
+                                           {txCredits(FC_NONPOST); return MemReadLockDigest(addr, length, tag, rid, lock, digest, queue, node);};
 
     pPktData_t completionDigest        (const uint64_t addr, const PktData_t *data, const int status, const int fbe, const int lbe, const int length,
                                         const int tag, const uint32_t cid, const uint32_t rid, const bool digest = true, const bool queue = false)
-                                           {return CompletionDigest(addr, data, status, fbe, lbe, length, tag, cid, rid, digest, queue, node);};
+                                           {txCredits(FC_CMPL, data ? length * 4 : 0); return CompletionDigest(addr, data, status, fbe, lbe, length, tag, cid, rid, digest, queue, node);};
 
     pPktData_t partCompletionDigest    (const uint64_t addr, const PktData_t *data, const int status, const int fbe, const int lbe, const int rlength,
                                         const int length, const int tag , const uint32_t cid, const uint32_t rid, const bool digest = true, const bool queue = false)
-                                           {return PartCompletionDigest(addr, data, status, fbe, lbe, rlength, length, tag, cid, rid, digest, queue, node);};
+                                           {txCredits(FC_CMPL, data ? length * 4 : 0); return PartCompletionDigest(addr, data, status, fbe, lbe, rlength, length, tag, cid, rid, digest, queue, node);};
 
     pPktData_t partCompletionLockDelay (const uint64_t addr, const PktData_t *data, const int status, const int fbe, const int lbe, const int rlength,
                                         const int length, const int tag, const uint32_t cid, const uint32_t rid, const bool lock, const bool digest,
                                         const bool delay, const bool queue)
-                                        {return PartCompletionLockDelay(addr, data, status, fbe, lbe, rlength, length, tag, cid, rid, lock, digest, delay, queue, node);};
+                                        {txCredits(FC_CMPL, data ? length * 4 : 0); return PartCompletionLockDelay(addr, data, status, fbe, lbe, rlength, length, tag, cid, rid, lock, digest, delay, queue, node);};
 
     pPktData_t cfgWriteDigest          (const uint64_t addr, const PktData_t *data, const int length, const int tag, const uint32_t rid, const bool digest = true,
                                         const bool queue = false)
-                                           {return CfgWriteDigest(addr, data, length, tag, rid, digest, queue, node);};
+                                           {txCredits(FC_NONPOST, length); return CfgWriteDigest(addr, data, length, tag, rid, digest, queue, node);};
 
     pPktData_t cfgReadDigest           (const uint64_t addr, const int length, const int tag, const uint32_t rid, const bool digest = true, const bool queue = false)
-                                           {return CfgReadDigest(addr, length, tag, rid, digest, queue, node);};
+                                           {txCredits(FC_NONPOST); return CfgReadDigest(addr, length, tag, rid, digest, queue, node);};
 
     pPktData_t ioWriteDigest           (const uint64_t addr, const PktData_t *data, const int length, const int tag, const uint32_t rid, const bool digest = true,
                                         const bool queue = false)
-                                           {return IoWriteDigest(addr, data, length, tag, rid, digest, queue, node);};
+                                           {txCredits(FC_NONPOST, length); return IoWriteDigest(addr, data, length, tag, rid, digest, queue, node);};
 
     pPktData_t ioReadDigest            (const uint64_t addr, const int length, const int tag, const uint32_t rid, const bool digest = true, const bool queue = false)
-                                           {return IoReadDigest(addr, length, tag, rid, digest, queue, node);};
+                                           {txCredits(FC_NONPOST); return IoReadDigest(addr, length, tag, rid, digest, queue, node);};
 
     pPktData_t messageDigest           (const int code, const PktData_t *data, const int length, const int tag, const uint32_t rid, const bool digest = true,
                                         const bool queue = false)
-                                           {return MessageDigest(code, data, length, tag, rid, digest, queue, node);};
+                                           {txCredits(FC_POST, length); return MessageDigest(code, data, length, tag, rid, digest, queue, node);};
 
     // Flow control initialisation
     void       initFc               (void)                 {InitFc(node);};
@@ -140,6 +194,32 @@ public:
 #if !defined(EXCLUDE_LTSSM) && !defined(OSVVM)
     // Link initialisation
     void       initLink             (const int linkwidth, const int gen = TS_DATA_RATE_GEN1)  {InitLinkGen(linkwidth, gen, node);};
+
+    // LTSSM configuration (CONFIG_LTSSM_xxx types)
+    void       configureLtssm       (const config_t type, const int value)       {ConfigurePcieLtssm(type, value, node);};
+
+    // ASPM idle timer policy, with low power state residency, entries, exits and exit cycles
+    // for each state (ASPM_STATE_xxx and ASPM_STAT_xxx). Cycles are idled in L0 while an Ack
+    // or other queued DLLPs of this class are still to be sent, as AspmIdle() requires. The
+    // receive callback passes the link partner's PM DLLPs on to AspmRxDllp().
+    void       aspmIdle             (const int ticks)
+                                        {
+                                            int t = 0;
+
+                                            for (; t < ticks && (txPending || (ack.isEnabled() && ack.isAckPending())); t++)
+                                            {
+                                                idleTick();
+                                            }
+
+                                            if (t < ticks)
+                                            {
+                                                AspmIdle(ticks - t, node);
+                                            }
+                                        };
+    void       aspmExit             (void)                 {AspmExit(node);};
+    int        getAspmState         (void)                 {return GetAspmState(node);};
+    void       resetAspmStats       (void)                 {ResetAspmStats(node);};
+    uint32_t   readAspmStat         (const int state, const int type)            {return ReadAspmStat(state, type, node);};
 #endif
     // Queue flushing
     void       sendPacket           (void)                 {SendPacket(node);};
@@ -158,7 +238,15 @@ public:
                                                            {SendVendor(queue, data, node);};
 
     // Physical layer Ordered sets etc.
-    void       sendIdle             (const int ticks = 1)  {SendIdle(ticks, node);};
+    void       sendIdle             (const int ticks = 1)
+                                        {
+                                            if (!needsTick())
+                                                SendIdle(ticks, node);
+                                            else
+                                                for (int t = 0; t < ticks; t++) idleTick();
+
+                                            if (batchSize == 0) flushRxBatch();
+                                        };
     void       sendOs               (const int type)       {SendOs(type, node);};
     void       sendTs               (const int identifier, const int lane_num, const int link_num, const int n_fts, const int control,
                                      const bool is_gen2 = false)
@@ -171,12 +259,81 @@ public:
                                                            {WaitForCompletionN(count, node);};
     void       waitForCompletionN   (const uint32_t count) {WaitForCompletionN(count, node);};
     void       initialisePcie       (const callback_t    cb_func, void *usrptr = NULL)
-                                                           {InitialisePcie(cb_func, usrptr, node);};
+                                        {
+                                            flushRxBatch();
+                                            batchCb   = NULL;
+                                            batchPtr  = NULL;
+                                            tlpCb     = NULL;
+                                            tlpPtr    = NULL;
+                                            userCb    = cb_func;
+                                            userPtr   = usrptr;
+                                            InitialisePcie(rxCallback, this, node);
+                                        };
+
+    // Alternative to initialisePcie, with received packets passed to the callback in batches of
+    // read-only views, when size is 0 after each sendIdle() call and each cycle idled within
+    // the class (such as waiting for a tag), or else every size packets. The packets are
+    // discarded by this class when the callback returns. flushRxBatch() passes on any packets
+    // held. Each initialisation replaces the callbacks of the others.
+    void       initialisePcieBatch  (const batch_callback_t cb_func, void *usrptr = NULL, const int size = 0)
+                                        {
+                                            flushRxBatch();
+                                            userCb    = NULL;
+                                            userPtr   = NULL;
+                                            tlpCb     = NULL;
+                                            tlpPtr    = NULL;
+                                            batchCb   = cb_func;
+                                            batchPtr  = usrptr;
+                                            batchSize = size;
+                                            InitialisePcie(rxCallback, this, node);
+                                        };
+    void       flushRxBatch         (void)
+                                        {
+                                            // Not re-entered from the callback, with packets arriving meanwhile held for the next batch
+                                            if (rxViews.empty() || inFlush)
+                                            {
+                                                return;
+                                            }
+
+                                            inFlush = true;
+                                            rxViews.swap(rxDeliverViews);
+                                            rxPkts.swap(rxDeliverPkts);
+
+                                            batchCb(rxDeliverViews.data(), (int)rxDeliverViews.size(), batchPtr);
+
+                                            for (size_t idx = 0; idx < rxDeliverPkts.size(); idx++)
+                                            {
+                                                DISCARD_PACKET(rxDeliverPkts[idx]);
+                                            }
+
+                                            rxDeliverViews.clear();
+                                            rxDeliverPkts.clear();
+                                            inFlush = false;
+                                        };
+
+    // Alternative to initialisePcie, with each received packet passed to the callback in an
+    // owning pcieTlp handle, which discards the packet when destroyed unless moved elsewhere
+    void       initialisePcieTlp    (const tlp_callback_t cb_func, void *usrptr = NULL)
+                                        {
+                                            flushRxBatch();
+                                            userCb    = NULL;
+                                            userPtr   = NULL;
+                                            batchCb   = NULL;
+                                            batchPtr  = NULL;
+                                            tlpCb     = cb_func;
+                                            tlpPtr    = usrptr;
+                                            InitialisePcie(rxCallback, this, node);
+                                        };
+
+    // Decoded header of the TLP being passed to the receive callback
+    const pcieTlpHdr_t* getRxHdr    (void)                 {return &rxHdr;};
+
     void       registerOsCallback   (const os_callback_t cb_func)
                                                            {RegisterOsCallback(cb_func, node);};
     uint32_t   getCycleCount        (void)                 {return GetCycleCount(node);};
+    unsigned   getNode              (void)                 {return node;};
     void       configurePcie        (const config_t type, const int value = 0)
-                                        {ConfigurePcie(type, value, node);};
+                                        {fcConfig(type, value); ConfigurePcie(type, value, node);};
 
     // Physical layer event routines
     int        resetEventCount      (const int type)       {return ResetEventCount(type, node);};
@@ -187,6 +344,21 @@ public:
     // Miscellaneous support routines
     uint32_t   pcieRand             (void)                 {return PcieRand(node);};
     void       pcieSeed             (const uint32_t seed)  {PcieSeed(seed, node);};
+
+    // Counter based random streams, independent for each feature (PCIE_RNG_STREAM_xxx) and
+    // node. rngSeed() restarts this class's and the LTSSM's streams from a new seed, and
+    // rngStream() selects a stream of the current seed.
+    void       rngSeed              (const uint64_t seed)
+                                        {
+                                            rngSeedVal = seed;
+                                            PcieRngInit(&cplRng, seed, PCIE_RNG_STREAM_ID(PCIE_RNG_STREAM_CPL, node));
+#if !defined(EXCLUDE_LTSSM) && !defined(OSVVM)
+                                            LtssmSeed(seed, node);
+#endif
+                                        };
+    uint64_t   getRngSeed           (void)                 {return rngSeedVal;};
+    void       rngStream            (pcieRng_t* rng, const uint32_t feature)
+                                                           {PcieRngInit(rng, rngSeedVal, PCIE_RNG_STREAM_ID(feature, node));};
     void       setTxEnabled         (void)                 {SetTxEnabled(node);};
     void       setTxDisabled        (void)                 {SetTxDisabled(node);};
     void       selectGen1Clock      (void)                 {SelectGen1Clock(node);};
@@ -194,6 +366,11 @@ public:
     void       getPcieVersionStr    (char* sbuf, const int bufsize)
                                                            {getPcieVersionString(sbuf, bufsize);};
 
+    // Link utilisation monitor
+    void       configLinkUtil       (const int window)     {ConfigLinkUtil(window, node);};
+    uint32_t   readLinkUtil         (const int dir, const int lane, const int type, const bool lastWindow = false)
+                                                           {return ReadLinkUtil(dir, lane, type, lastWindow, node);};
+
     // Memory access
     void       writeRamByteBlock    (const uint64_t addr, const PktData_t* const data, const int fbe, const int lbe, const int length)
                                         {WriteRamByteBlock(addr, data, fbe, lbe, length, node);};
@@ -214,9 +391,847 @@ public:
     void       writeConfigSpaceMask (const uint32_t addr, const uint32_t data)                              {WriteConfigSpaceMask(addr, data, node);};
     uint32_t   readConfigSpaceMask  (const uint32_t addr)                                                  {return ReadConfigSpaceMask(addr, node);};
 
+    // Non-blocking requests. Completions are matched against outstanding requests
+    // in the received packet callback, so initialisePcie() must have been called.
+    // The request handle must remain valid until the request has finished.
+    int        memReadAsync         (const uint64_t addr, PktData_t* buf, const int length, const uint32_t rid, pcieRequest_t* req,
+                                     const int tag = TLP_TAG_AUTO, const bool queue = false, const bool digest = false)
+                                        {
+                                            int t = allocateTag(addr, buf, length, rid, req, tag, PCIE_LAT_MEM_RD);
+                                            if (t >= 0)
+                                            {
+                                                txCredits(FC_NONPOST);
+                                                setTag(MemReadLockDigest(addr, length, t & BYTE_MASK, rid, false, digest, true, node), t);
+                                                if (!queue) SendPacket(node);
+                                            }
+                                            return t;
+                                        };
+
+    int        cfgReadAsync         (const uint64_t addr, PktData_t* buf, const int length, const uint32_t rid, pcieRequest_t* req,
+                                     const int tag = TLP_TAG_AUTO, const bool queue = false, const bool digest = false)
+                                        {
+                                            int t = allocateTag(addr, buf, length, rid, req, tag, PCIE_LAT_CFG_RD);
+                                            if (t >= 0)
+                                            {
+                                                txCredits(FC_NONPOST);
+                                                setTag(CfgReadDigest(addr, length, t & BYTE_MASK, rid, digest, true, node), t);
+                                                if (!queue) SendPacket(node);
+                                            }
+                                            return t;
+                                        };
+
+    // Burst transfers of any length, split into TLPs on max payload size (writes) or
+    // max read request size (reads) boundaries, as set in the model's device control.
+    // Writes are queued and sent back-to-back, returning the number of TLPs generated.
+    int        memWriteBurst        (const uint64_t addr, const PktData_t *data, const int length, const uint32_t rid, const bool digest = false)
+                                        {
+                                            int      mps   = getMaxPayloadSize();
+                                            int      count = 0;
+
+                                            shadowWrite(addr, data, length);
+
+                                            for (int offset = 0; offset < length; count++)
+                                            {
+                                                int chunk = burstChunk(addr + offset, length - offset, mps);
+                                                txCredits(FC_POST, chunk);
+                                                MemWriteDigest(addr + offset, &data[offset], chunk, 0, rid, digest, true, node);
+                                                offset += chunk;
+                                            }
+
+                                            SendPacket(node);
+
+                                            return count;
+                                        };
+
+    // Reads are all issued before waiting, up to the outstanding request limit,
+    // returning true if all completed successfully
+    bool       memReadBurst         (const uint64_t addr, PktData_t *buf, const int length, const uint32_t rid, const bool digest = false)
+                                        {
+                                            int                        mrrs = getMaxReadReqSize();
+                                            bool                       ok   = true;
+                                            std::vector<pcieRequest_t> req((length + mrrs - 1) / mrrs + 1);
+
+                                            int count = 0;
+                                            for (int offset = 0; offset < length; count++)
+                                            {
+                                                int chunk = burstChunk(addr + offset, length - offset, mrrs);
+                                                memReadAsync(addr + offset, &buf[offset], chunk, rid, &req[count], TLP_TAG_AUTO, true, digest);
+                                                offset += chunk;
+                                            }
+
+                                            SendPacket(node);
+
+                                            for (int idx = 0; idx < count; idx++)
+                                            {
+                                                ok = waitForRequest(&req[idx]) && ok;
+                                            }
+
+                                            return ok;
+                                        };
+
+    // Max payload and max read request sizes from the PCIe capability device control
+    int        getMaxPayloadSize    (void)
+                                        {
+                                            uint32_t devctl = getDevCtl(CFG_PCIE_DEV_CTL_OFFSET);
+                                            return devctl ? devCtlSize(devctl >> DEV_CTL_MPS_BIT_POS)  : DEFAULT_MPS_BYTES;
+                                        };
+
+    int        getMaxReadReqSize    (void)
+                                        {
+                                            uint32_t devctl = getDevCtl(CFG_PCIE_DEV_CTL_OFFSET);
+                                            return devctl ? devCtlSize(devctl >> DEV_CTL_MRRS_BIT_POS) : DEFAULT_MRRS_BYTES;
+                                        };
+
+    bool       isComplete           (const pcieRequest_t* req)  {return req->state != PCIE_REQ_PENDING;};
+
+    // Wait for a request to finish, returning true if it completed successfully
+    bool       waitForRequest       (const pcieRequest_t* req)
+                                        {
+                                            while (req->state == PCIE_REQ_PENDING)
+                                            {
+                                                idleTick();
+                                                reqs.checkTimeouts(GetCycleCount(node));
+                                            }
+                                            return req->state == PCIE_REQ_COMPLETE && req->cplStatus == CPL_SUCCESS;
+                                        };
+
+    void       waitForAllRequests   (void)
+                                        {
+                                            while (reqs.getNumOutstanding())
+                                            {
+                                                idleTick();
+                                                reqs.checkTimeouts(GetCycleCount(node));
+                                            }
+                                        };
+
+    int        checkTimeouts        (void)                 {return reqs.checkTimeouts(GetCycleCount(node));};
+    bool       setTagBits           (const int bits)       {return reqs.setTagBits(bits);};
+    void       setMaxOutstanding    (const int max)        {reqs.setMaxOutstanding(max);};
+    bool       canIssue             (void)                 {return reqs.canIssue();};
+    void       setCplTimeout        (const uint32_t cycles){reqs.setCplTimeout(cycles);};
+    int        getNumOutstanding    (void)                 {return reqs.getNumOutstanding();};
+
+    // Latency statistics for non-blocking requests, from issue to final completion,
+    // for each request type (PCIE_LAT_MEM_RD etc.)
+    uint32_t   getLatencyCount      (const int type)       {return reqs.getLatencyStats()->getCount(type);};
+    uint32_t   getLatencyMin        (const int type)       {return reqs.getLatencyStats()->getMin(type);};
+    uint32_t   getLatencyMax        (const int type)       {return reqs.getLatencyStats()->getMax(type);};
+    double     getLatencyMean       (const int type)       {return reqs.getLatencyStats()->getMean(type);};
+    uint32_t   getLatencyPercentile (const int type, const double pct)
+                                                           {return reqs.getLatencyStats()->getPercentile(type, pct);};
+    void       resetLatencyStats    (void)                 {reqs.getLatencyStats()->reset();};
+
+    // Shadow memory checking. When enabled, memory writes issued through this class update
+    // a shadow of the target memory, and the data of non-blocking memory reads is checked
+    // against it on completion. Mismatches are reported and counted.
+    void       enableShadow         (const bool en = true, const bool report = true)
+                                                           {shadow.setEnabled(en); shadow.setReport(report);};
+    void       clearShadow          (void)                 {shadow.clear();};
+    uint32_t   getShadowChecks      (void)                 {return shadow.getNumChecks();};
+    uint32_t   getShadowMismatches  (void)                 {return shadow.getNumMismatchReads();};
+    uint64_t   getShadowMismatchBytes (void)               {return shadow.getNumMismatchBytes();};
+    void       resetShadowStats     (void)                 {shadow.resetStats();};
+    bool       dumpLatencyStats     (const char* filename, const bool json = false)
+                                                           {return reqs.getLatencyStats()->dump(filename, json);};
+
+    // Memory completer, replacing the model's internal memory auto-completion so that
+    // read completions are split on read completion boundaries (RCB) as real completers
+    // do. The split policy is one of completions of up to max payload size ending on an
+    // RCB (PCIE_CPL_SPLIT_MPS), a completion for each RCB (PCIE_CPL_SPLIT_RCB) or random
+    // multiples of RCB (PCIE_CPL_SPLIT_RANDOM). With an RCB of 0 it is taken from the
+    // model's link control. Memory writes still update the model's memory, and
+    // configuration and IO requests are completed as the model would.
+    void       enableCompleter      (const uint32_t cid, const int policy = PCIE_CPL_SPLIT_MPS, const int rcb = 0, const bool delay = false)
+                                        {
+                                            uint32_t linkctl = getDevCtl(CFG_PCIE_LINK_CTL_OFFSET);
+
+                                            cplCid    = cid;
+                                            cplPolicy = policy;
+                                            cplDelay  = delay;
+                                            cplMps    = getMaxPayloadSize();
+                                            cplRcb    = (rcb == RCB_64_BYTES || rcb == RCB_128_BYTES) ? rcb :
+                                                        (linkctl & LINK_CTL_RCB)                      ? RCB_128_BYTES : RCB_64_BYTES;
+
+                                            ConfigurePcie(CONFIG_DISABLE_MEM, 0, node);
+                                        };
+
+    void       disableCompleter     (void)
+                                        {
+                                            cplPolicy = PCIE_CPL_SPLIT_OFF;
+                                            ConfigurePcie(classCompletes() ? CONFIG_DISABLE_MEM : CONFIG_ENABLE_MEM, 0, node);
+                                        };
+
+    // UpdateFC policy. Other than PCIE_FC_POLICY_MODEL, the model's internal flow control is
+    // disabled (CONFIG_DISABLE_FC) and received credits are returned as UpdateFC DLLPs according
+    // to the policy. Every received TLP must then be accounted for, so memory auto-completion is
+    // also disabled and the class completes all memory, configuration and IO requests, as for
+    // the completer. The model no longer checks transmit credits either, so the class's TLP
+    // generators wait for VC0 credits from the link partner's flow control DLLPs. TLPs generated
+    // by calling the model's C API directly are not accounted for. Call after initialisePcie(),
+    // so that the link partner's flow control DLLPs are seen, and before TLPs are received, as
+    // credits consumed under the model's flow control are not returned by the policy.
+    void       setFcPolicy          (const int policy)
+                                        {
+                                            fc.setPolicy(policy);
+                                            fc.reset(GetCycleCount(node));
+
+                                            if (cplPolicy == PCIE_CPL_SPLIT_OFF)
+                                            {
+                                                cplMps = getMaxPayloadSize();
+                                            }
+
+                                            ConfigurePcie(policy == PCIE_FC_POLICY_MODEL ? CONFIG_ENABLE_FC : CONFIG_DISABLE_FC, 0, node);
+                                            ConfigurePcie(classCompletes() ? CONFIG_DISABLE_MEM : CONFIG_ENABLE_MEM, 0, node);
+                                        };
+
+    void       setFcThreshold       (const int type, const uint32_t hdr, const uint32_t data)
+                                                           {fc.setThreshold(type, hdr, data);};
+    void       setFcTimer           (const uint32_t cycles){fc.setTimer(cycles);};
+    void       setFcCoalesce        (const uint32_t cycles){fc.setCoalesce(cycles);};
+
+    uint32_t   getZeroCreditCycles  (const int type)       {return fc.getZeroCreditCycles(type, GetCycleCount(node));};
+    uint32_t   getNumFcUpdates      (const int type)       {return fc.getNumUpdates(type);};
+
+    // Queue any UpdateFC DLLPs due under the policy, to be sent on the next idle cycle
+    void       processFc            (void)
+                                        {
+                                            static const int updateType[FC_NUMTYPES] = {DL_UPDATEFC_P, DL_UPDATEFC_NP, DL_UPDATEFC_CPL};
+
+                                            uint32_t now = GetCycleCount(node);
+                                            uint32_t hdrfc, datafc;
+
+                                            for (int type = 0; type < FC_NUMTYPES; type++)
+                                            {
+                                                if (fc.getUpdate(type, now, hdrfc, datafc))
+                                                {
+                                                    SendFC(updateType[type], 0, hdrfc, datafc, true, node);
+                                                    txPending = true;
+                                                }
+                                            }
+                                        };
+
+    // Ack/Nak latency timer. When enabled the model's Ack and Nak generation is disabled
+    // (CONFIG_DISABLE_ACK) and a single Ack is sent for all the good TLPs received within
+    // the Ack transmission latency limit for the model's max payload size and the given
+    // link width and generation. Received Ack and Nak DLLPs are then passed to the user
+    // callback.
+    void       setAckLatency        (const bool enable, const int width = 1, const int gen = 1)
+                                        {
+                                            ack.setLatency(getMaxPayloadSize(), width, gen);
+                                            ack.setEnabled(enable);
+                                            ConfigurePcie(enable ? CONFIG_DISABLE_ACK : CONFIG_ENABLE_ACK, 0, node);
+                                        };
+
+    void       setAckLatencyTimer   (const uint32_t cycles){ack.setLatencyTimer(cycles);};
+    uint32_t   getAckLatencyTimer   (void)                 {return ack.getLatencyTimer();};
+
+    uint32_t   getNumAckedTlps      (void)                 {return ack.getNumTlps();};
+    uint32_t   getNumAcks           (void)                 {return ack.getNumAcks();};
+    uint32_t   getNumNaks           (void)                 {return ack.getNumNaks();};
+    uint32_t   getNumDuplicateTlps  (void)                 {return ack.getNumDuplicates();};
+    uint32_t   getAckOverhead       (void)                 {return ack.getAckOverhead();};
+    void       resetAckStats        (void)                 {ack.resetStats();};
+
+    // Send an Ack if the latency timer has expired
+    void       processAck           (void)
+                                        {
+                                            int seq;
+
+                                            if (ack.getAck(GetCycleCount(node), seq))
+                                            {
+                                                SendAck(seq, node);
+                                            }
+                                        };
+
+    // Virtual channels. TLPs are queued with a traffic class and sent with sendVc(), which
+    // arbitrates between the VCs the TCs map to. VC1 to VC7 must be initialised with initVc(),
+    // which starts flow control initialisation with the VC's received credits (0 for infinite).
+    // The InitFC DLLPs are resent from the idle loop until the link partner's are seen, which
+    // isVcInit() reports. The model's own flow control only knows VC0, so under
+    // PCIE_FC_POLICY_MODEL it charges TLPs of all VCs to VC0 credits, in both directions.
+    // Another UpdateFC policy keeps VC0 accounting to VC0 TLPs.
+    void       setTcVcMap           (const int tc, const int vc)  {arb.setTcVc(tc, vc);};
+    void       setVcArbitration     (const int arbitration)       {arb.setArbitration(arbitration);};
+    void       setVcWeight          (const int vc, const int weight)
+                                                                  {arb.setWeight(vc, weight);};
+
+    void       initVc               (const int vc, const uint32_t phdr,   const uint32_t pdata,  const uint32_t nphdr, const uint32_t npdata,
+                                     const uint32_t cplhdr = FC_INFINITE_CREDITS, const uint32_t cpldata = FC_INFINITE_CREDITS)
+                                        {
+                                            const uint32_t hdr[FC_NUMTYPES]  = {phdr,  nphdr,  cplhdr};
+                                            const uint32_t data[FC_NUMTYPES] = {pdata, npdata, cpldata};
+
+                                            arb.setEnabled(vc, true);
+                                            arb.startFcInit(vc);
+
+                                            for (int type = 0; type < FC_NUMTYPES; type++)
+                                            {
+                                                arb.setRxCredits(vc, type, hdr[type], data[type]);
+                                            }
+
+                                            queueVcInitFc(vc);
+                                            SendPacket(node);
+                                        };
+
+    bool       isVcInit             (const int vc)         {return arb.isFcInitDone(vc);};
+
+    void       memWriteTc           (const uint64_t addr, const PktData_t *data, const int length, const int tc, const uint32_t rid,
+                                     const bool digest = false)
+                                        {
+                                            std::vector<PktData_t> buf(data, data + length);
+                                            int                    dws = ((int)(addr & ADDR_DW_OFFSET_MASK) + length + 3) / 4;
+                                            pcieVcTlp_t            tlp;
+
+                                            shadowWrite(addr, data, length);
+
+                                            tlp.gen    = [this, addr, buf, length, rid, digest]() {return MemWriteDigest(addr, buf.data(), length, 0, rid, digest, true, node);};
+                                            tlp.tc     = tc;
+                                            tlp.fctype = FC_POST;
+                                            tlp.hdr    = 1;
+                                            tlp.data   = (dws * 4 + FC_DATA_CREDIT_BYTES - 1) / FC_DATA_CREDIT_BYTES;
+
+                                            arb.enqueue(tlp);
+                                        };
+
+    // The request's tag is allocated when the read wins arbitration
+    void       memReadTc            (const uint64_t addr, PktData_t* buf, const int length, const int tc, const uint32_t rid, pcieRequest_t* req,
+                                     const bool digest = false)
+                                        {
+                                            pcieVcTlp_t tlp;
+
+                                            req->state = PCIE_REQ_PENDING;
+
+                                            tlp.gen    = [this, addr, buf, length, rid, req, digest]() {
+                                                             int        t   = allocateTag(addr, buf, length, rid, req, TLP_TAG_AUTO, PCIE_LAT_MEM_RD);
+                                                             pPktData_t pkt = MemReadLockDigest(addr, length, t & BYTE_MASK, rid, false, digest, true, node);
+                                                             setTag(pkt, t);
+                                                             return pkt;
+                                                         };
+                                            tlp.tc     = tc;
+                                            tlp.fctype = FC_NONPOST;
+                                            tlp.hdr    = 1;
+                                            tlp.data   = 0;
+
+                                            arb.enqueue(tlp);
+                                        };
+
+    // Send all the TLPs queued on the VCs, idling whilst blocked for VC credits. Returns
+    // false, with the blocked TLPs left queued, if no TLP could be sent for the timeout cycles.
+    bool       sendVc               (const uint32_t timeout = PCIE_VC_DEFAULT_TIMEOUT)
+                                        {
+                                            pcieVcTlp_t tlp;
+                                            uint32_t    last = GetCycleCount(node);
+
+                                            while (!arb.isEmpty())
+                                            {
+                                                if (arb.next(tlp))
+                                                {
+                                                    last = GetCycleCount(node);
+
+                                                    pPktData_t pkt = tlp.gen();
+
+                                                    if (pkt != NULL && tlp.tc)
+                                                    {
+                                                        SET_TLP_TC(tlp.tc, pkt);
+                                                        if (TLP_HAS_DIGEST(pkt)) CalcEcrc(pkt);
+                                                        CalcLcrc(pkt);
+                                                    }
+
+                                                    SendPacket(node);
+                                                }
+                                                else if ((uint32_t)(GetCycleCount(node) - last) >= timeout)
+                                                {
+                                                    return false;
+                                                }
+                                                else
+                                                {
+                                                    idleTick();
+                                                }
+                                            }
+
+                                            return true;
+                                        };
+
 private:
 
-    unsigned node;
+    // Advance one cycle, processing UpdateFC policy and Ack latency timer when enabled,
+    // sending any packets queued in the cycle and passing on a per cycle receive batch
+    void       idleTick             (void)
+                                        {
+                                            SendIdle(1, node);
+                                            if (fc.getPolicy() != PCIE_FC_POLICY_MODEL) processFc();
+                                            if (ack.isEnabled())                        processAck();
+                                            if (arb.hasVcs())                           processVcInit();
+                                            sendPending();
+                                            if (batchSize == 0)                         flushRxBatch();
+                                        };
+
+    // Idle cycles are stepped one at a time when the policies, completer or VCs may have
+    // packets to process or send between cycles
+    bool       needsTick            (void)
+                                        {
+                                            return classCompletes() || ack.isEnabled() || arb.hasVcs();
+                                        };
+
+    // Queue the InitFC DLLPs of a VC's current flow control initialisation stage
+    void       queueVcInitFc        (const int vc)
+                                        {
+                                            int kind = arb.fcInitKind(vc);
+
+                                            for (int type = 0; kind && type < FC_NUMTYPES; type++)
+                                            {
+                                                SendFC(kind | (type << 4), vc, arb.getRxInitHdr(vc, type), arb.getRxInitData(vc, type), true, node);
+                                            }
+
+                                            arb.fcInitSent(vc, kind);
+                                        };
+
+    // Resend the InitFC DLLPs of VCs still initialising, every INITFC_DELAY cycles
+    void       processVcInit        (void)
+                                        {
+                                            if ((uint32_t)(GetCycleCount(node) - vcInitTime) < INITFC_DELAY)
+                                            {
+                                                return;
+                                            }
+
+                                            vcInitTime = GetCycleCount(node);
+
+                                            for (int vc = 1; vc < MAX_VIRTUAL_CHANNELS; vc++)
+                                            {
+                                                if (arb.isEnabled(vc) && arb.fcInitKind(vc))
+                                                {
+                                                    queueVcInitFc(vc);
+                                                    txPending = true;
+                                                }
+                                            }
+                                        };
+
+    // Send the packets queued by the completer, policies and VCs, which can only be sent once
+    // the receive callback has returned, and once the link partner has the credits for any
+    // queued completions
+    void       sendPending          (void)
+                                        {
+                                            if (txPending && fc.txHasCredits(FC_CMPL, txCplHdr, txCplData))
+                                            {
+                                                fc.txConsume(FC_CMPL, txCplHdr, txCplData);
+                                                txPending = false;
+                                                txCplHdr  = 0;
+                                                txCplData = 0;
+                                                SendPacket(node);
+                                            }
+                                        };
+
+    // Wait for the link partner's credits for a TLP with a payload of the given number of
+    // bytes, and consume them. Credits are always available under PCIE_FC_POLICY_MODEL.
+    void       txCredits            (const int type, const int bytes = 0)
+                                        {
+                                            while (!fc.txHasCredits(type, 1, pcieFcPolicy::dataCredits(bytes)))
+                                            {
+                                                idleTick();
+                                            }
+
+                                            fc.txConsume(type, 1, pcieFcPolicy::dataCredits(bytes));
+                                        };
+
+    // Memory, configuration and IO requests are completed by the class when the completer
+    // is enabled, or when an UpdateFC policy needs to account for them
+    bool       classCompletes       (void)                 {return cplPolicy != PCIE_CPL_SPLIT_OFF || fc.getPolicy() != PCIE_FC_POLICY_MODEL;};
+
+    // Keep initial advertised credits in step with the model's configuration
+    void       fcConfig             (const config_t type, const int value)
+                                        {
+                                            // Credit configuration types are ordered header then data for posted,
+                                            // non-posted and completion, as for the FC types
+                                            if (type >= CONFIG_POST_HDR_CR && type <= CONFIG_CPL_DATA_CR)
+                                            {
+                                                int fctype = (type - CONFIG_POST_HDR_CR) / 2;
+
+                                                if ((type - CONFIG_POST_HDR_CR) & 1)
+                                                {
+                                                    fc.setInitCredits(fctype, fc.getInitHdr(fctype), value);
+                                                }
+                                                else
+                                                {
+                                                    fc.setInitCredits(fctype, value, fc.getInitData(fctype));
+                                                }
+                                            }
+                                        };
+
+    // Size of next burst TLP, not crossing a multiple of the maximum size (and so not a 4K boundary)
+    int        burstChunk           (const uint64_t addr, const int remaining, const int max)
+                                        {
+                                            int chunk = max - (int)(addr % max);
+                                            return remaining < chunk ? remaining : chunk;
+                                        };
+
+    int        devCtlSize           (const uint32_t field)
+                                        {
+                                            int size = 128 << (field & DEV_CTL_SIZE_MASK);
+                                            return size > MAX_MPS_BYTES ? MAX_MPS_BYTES : size;
+                                        };
+
+    // Find the PCIe capability in the model's configuration space and return the 16-bit
+    // register at the given offset within it, with bit 16 set to flag it was found
+    uint32_t   getDevCtl            (const uint32_t offset)
+                                        {
+                                            uint32_t ptr = ReadConfigSpace(CFG_CAPABILITIES_PTR_OFFSET, node) & ADDR_LO_BYTE_MASK;
+
+                                            for (int count = 0; ptr != 0 && count < 48; count++)
+                                            {
+                                                uint32_t hdr = ReadConfigSpace(ptr, node);
+
+                                                if ((hdr & BYTE_MASK) == PCIECAPTYPE)
+                                                {
+                                                    uint32_t reg = ReadConfigSpace(ptr + (offset & ~ADDR_DW_OFFSET_MASK), node);
+                                                    return 0x10000 | ((reg >> ((offset & ADDR_DW_OFFSET_MASK) * 8)) & 0xffff);
+                                                }
+
+                                                ptr = (hdr >> 8) & ADDR_LO_BYTE_MASK;
+                                            }
+
+                                            return 0;
+                                        };
+
+    void       shadowWrite          (const uint64_t addr, const PktData_t* data, const int length)
+                                        {
+                                            if (shadow.isEnabled())
+                                            {
+                                                shadow.write(addr, data, length);
+                                            }
+                                        };
+
+    // Allocate a tag for a new request, idling whilst the outstanding request limit is reached.
+    // Any queued requests are sent first, as they may be the ones to be completed.
+    int        allocateTag          (const uint64_t addr, PktData_t* buf, const int length, const uint32_t rid, pcieRequest_t* req, const int tag,
+                                     const int type)
+                                        {
+                                            if (!reqs.canIssue())
+                                            {
+                                                SendPacket(node);
+                                            }
+
+                                            while (!reqs.canIssue())
+                                            {
+                                                idleTick();
+                                                reqs.checkTimeouts(GetCycleCount(node));
+                                            }
+
+                                            req->addr   = addr;
+                                            req->buf    = buf;
+                                            req->length = length;
+                                            req->rid    = rid;
+                                            req->type   = type;
+
+                                            return reqs.allocate(req, tag, GetCycleCount(node));
+                                        };
+
+    // The generators only encode 8 bits of tag (and map 255 to 0), so write the full
+    // tag into a queued request or completion and regenerate its CRCs when this would be lost
+    void       setTag               (PktData_t* pkt, const int tag, const int offset = TLP_TAG_OFFSET)
+                                        {
+                                            if (pkt != NULL && tag >= BYTE_MASK)
+                                            {
+                                                pkt[offset] = tag & BYTE_MASK;
+                                                SET_TAG10_HI(tag, pkt);
+                                                if (TLP_HAS_DIGEST(pkt)) CalcEcrc(pkt);
+                                                CalcLcrc(pkt);
+                                            }
+                                        };
+
+    // End address of the next read completion, according to the split policy. Completions
+    // other than the last always end on an RCB, and never exceed the max payload size.
+    uint64_t   cplSplit             (const uint64_t addr, const uint64_t end)
+                                        {
+                                            uint64_t base = addr & ~(uint64_t)(cplRcb - 1);
+                                            uint64_t next;
+
+                                            switch (cplPolicy)
+                                            {
+                                            case PCIE_CPL_SPLIT_RCB:
+                                                next = base + cplRcb;
+                                                break;
+                                            case PCIE_CPL_SPLIT_RANDOM:
+                                                next = base + cplRcb * (1 + PcieRngNext(&cplRng) % (cplMps / cplRcb));
+                                                break;
+                                            default:
+                                                next = (addr + cplMps) & ~(uint64_t)(cplRcb - 1);
+                                                break;
+                                            }
+
+                                            return next < end ? next : end;
+                                        };
+
+    // Complete a memory read or process a memory write TLP, returning true if the packet was
+    // consumed. The completions are all generated from a single read of the model's memory.
+    bool       completeMem          (const PktData_t* pkt, const pcieTlpHdr_t &hdr)
+                                        {
+                                            int      type   = hdr.type & TLP_TYPE_MASK;
+                                            uint64_t addr   = hdr.addr;
+                                            int      length = hdr.length;
+                                            int      fbe    = hdr.fbe;
+                                            int      lbe    = hdr.lbe;
+
+                                            if (type == TL_MWR32 || type == TL_MWR64)
+                                            {
+                                                WriteRamByteBlock(addr, &pkt[hdr.payloadOffset], fbe, lbe, length * 4, node);
+                                                return true;
+                                            }
+
+                                            if (type != TL_MRD32 && type != TL_MRD64)
+                                            {
+                                                return false;
+                                            }
+
+                                            uint64_t end    = addr + length * 4;
+                                            int      tag    = hdr.tag;
+                                            uint32_t rid    = hdr.rid;
+                                            bool     digest = hdr.digest;
+
+                                            ReadRamByteBlock(addr, cplBuf, length * 4, node);
+
+                                            for (uint64_t cur = addr; cur < end; )
+                                            {
+                                                uint64_t next   = cplSplit(cur, end);
+                                                int      offset = (int)(cur - addr) / 4;
+                                                int      rlen   = length - offset;
+
+                                                // Byte enables for the remaining bytes, where a single
+                                                // remaining DW takes the last byte enables as its first
+                                                int      cfbe   = (offset == 0) ? fbe : (rlen == 1) ? lbe : 0xf;
+                                                int      clbe   = (rlen == 1)   ? 0   : lbe;
+
+                                                setTag(PartCompletionDelay(cur, &cplBuf[offset * 4], CPL_SUCCESS, cfbe, clbe, rlen, (int)(next - cur) / 4,
+                                                                           tag & BYTE_MASK, cplCid, rid, digest, cplDelay, true, node),
+                                                       tag, CPL_TAG_OFFSET);
+                                                txCplHdr  += 1;
+                                                txCplData += pcieFcPolicy::dataCredits((int)(next - cur));
+                                                cur = next;
+                                            }
+
+                                            // Sent once the receive callback has returned
+                                            txPending = true;
+
+                                            return true;
+                                        };
+
+    // Complete a configuration or IO request TLP, returning true if the packet was consumed.
+    // With memory auto-completion disabled the model no longer completes these, so
+    // configuration accesses are made to the model's config space, as the model does, and
+    // IO requests are completed as unsupported. Configuration completions carry the
+    // request's target ID as the completer ID.
+    bool       completeCfgIo        (const PktData_t* pkt, const pcieTlpHdr_t &hdr)
+                                        {
+                                            int      type   = hdr.type & TLP_TYPE_MASK;
+                                            uint32_t addr   = (uint32_t)(hdr.addr & TLP_CFG_LO_ADDR_MASK);
+                                            int      fbe    = hdr.fbe;
+                                            int      tag    = hdr.tag;
+                                            uint32_t rid    = hdr.rid;
+                                            bool     digest = hdr.digest;
+                                            PktData_t cfg[4];
+
+                                            switch (type)
+                                            {
+                                            case TL_CFGRD0:
+                                            case TL_CFGRD1:
+                                                ReadConfigSpaceBuf(addr, cfg, 4, node);
+                                                setTag(PartCompletionDelay(0, cfg, CPL_SUCCESS, 0xf, 0, 1, 1, tag & BYTE_MASK, GET_CFG_CID(pkt), rid,
+                                                                           digest, cplDelay, true, node),
+                                                       tag, CPL_TAG_OFFSET);
+                                                txCplData += 1;
+                                                break;
+                                            case TL_CFGWR0:
+                                            case TL_CFGWR1:
+                                                WriteConfigSpaceBuf(addr, &pkt[hdr.payloadOffset], fbe, 0, 4, true, node);
+
+                                                // As the model, memory completions then use the captured ID
+                                                if (cplPolicy == PCIE_CPL_SPLIT_OFF)
+                                                {
+                                                    cplCid = GET_CFG_CID(pkt);
+                                                }
+
+                                                setTag(PartCompletionDelay(0, NULL, CPL_SUCCESS, fbe, 0, 1, 0, tag & BYTE_MASK, GET_CFG_CID(pkt), rid,
+                                                                           digest, cplDelay, true, node),
+                                                       tag, CPL_TAG_OFFSET);
+                                                break;
+                                            case TL_IORD:
+                                            case TL_IOWR:
+                                                setTag(PartCompletionDelay(0, NULL, CPL_UNSUPPORTED, fbe, 0, 1, 0, tag & BYTE_MASK, cplCid, rid,
+                                                                           digest, cplDelay, true, node),
+                                                       tag, CPL_TAG_OFFSET);
+                                                break;
+                                            default:
+                                                return false;
+                                            }
+
+                                            txCplHdr  += 1;
+                                            txPending  = true;
+
+                                            return true;
+                                        };
+
+    // Received packet callback, consuming completions for outstanding requests and,
+    // when enabled, memory, configuration and IO requests, before passing packets on to
+    // the user callback
+    static void rxCallback          (pPkt_t pkt, int status, void* usrptr)
+                                        {
+                                            pcieModelClass* p   = (pcieModelClass*)usrptr;
+                                            bool            tlp = status == PKT_STATUS_GOOD && pkt->seq != DLLP_SEQ_ID;
+
+                                            // Decode the header once for all the consumers of the packet
+                                            if (pkt->seq != DLLP_SEQ_ID)
+                                            {
+                                                pcieDecodeTlpHdr(pkt->data, p->rxHdr);
+                                            }
+                                            else
+                                            {
+                                                p->rxHdr = pcieTlpHdr_t();
+                                            }
+
+                                            // With the Ack policy, duplicate and out of sequence TLPs are discarded,
+                                            // and only a single Nak is sent for these and TLPs with a bad LCRC until
+                                            // a TLP is received in sequence
+                                            if (p->ack.isEnabled() && pkt->seq != DLLP_SEQ_ID)
+                                            {
+                                                int rxStatus = ACK_RX_GOOD;
+                                                int seq;
+
+                                                if (!(status & (PKT_STATUS_BAD_LCRC | PKT_STATUS_NULLIFIED)))
+                                                {
+                                                    rxStatus = p->ack.rxTlp(pkt->seq, GetCycleCount(p->node));
+                                                    p->processAck();
+                                                }
+
+                                                if ((rxStatus == ACK_RX_OUT_OF_SEQ || (status & PKT_STATUS_BAD_LCRC)) && p->ack.getNak(seq))
+                                                {
+                                                    SendNak(seq, p->node);
+                                                }
+
+                                                if (rxStatus != ACK_RX_GOOD)
+                                                {
+                                                    DISCARD_PACKET(pkt);
+                                                    return;
+                                                }
+                                            }
+
+                                            // The link partner's VC0 credits are tracked under all policies
+                                            if (status == PKT_STATUS_GOOD && pkt->seq == DLLP_SEQ_ID)
+                                            {
+                                                p->fc.txFcDllp(pkt->data);
+                                            }
+
+#if !defined(EXCLUDE_LTSSM) && !defined(OSVVM)
+                                            // PM DLLPs of the ASPM L1 handshake
+                                            if (status == PKT_STATUS_GOOD && pkt->seq == DLLP_SEQ_ID)
+                                            {
+                                                AspmRxDllp(pkt->data, p->node);
+                                            }
+#endif
+
+                                            if (tlp && p->fc.getPolicy() != PCIE_FC_POLICY_MODEL && p->arb.getVc(p->rxHdr.tc) == 0)
+                                            {
+                                                p->fc.rxTlp(pkt->data, GetCycleCount(p->node));
+                                                p->processFc();
+                                            }
+
+                                            // Flow control for VC1 to VC7
+                                            if (status == PKT_STATUS_GOOD && pkt->seq == DLLP_SEQ_ID)
+                                            {
+                                                p->arb.fcDllp(pkt->data);
+                                            }
+                                            else if (tlp)
+                                            {
+                                                int      vc, type;
+                                                uint32_t hdrfc, datafc;
+
+                                                if (p->arb.rxTlp(pkt->data, vc, type, hdrfc, datafc))
+                                                {
+                                                    SendFC(DL_UPDATEFC_P | (type << 4), vc, hdrfc, datafc, true, p->node);
+                                                    p->txPending = true;
+                                                }
+                                            }
+
+                                            pcieRequest_t* done = NULL;
+
+                                            if (tlp && p->reqs.getNumOutstanding() &&
+                                                p->rxHdr.isCpl &&
+                                                p->reqs.matchCompletion(pkt->data, GetCycleCount(p->node), &done))
+                                            {
+                                                if (done != NULL && done->type == PCIE_LAT_MEM_RD && done->buf != NULL &&
+                                                    done->cplStatus == CPL_SUCCESS && p->shadow.isEnabled())
+                                                {
+                                                    p->shadow.check(done->addr, done->buf, done->length, p->node);
+                                                }
+
+                                                DISCARD_PACKET(pkt);
+                                            }
+                                            else if (tlp && p->classCompletes() && (p->completeMem(pkt->data, p->rxHdr) || p->completeCfgIo(pkt->data, p->rxHdr)))
+                                            {
+                                                DISCARD_PACKET(pkt);
+                                            }
+                                            else if (p->batchCb != NULL)
+                                            {
+                                                pcieRxView_t view = {pkt->data, pkt->seq, status, pkt->TimeStamp, pkt->ByteCount, p->rxHdr};
+
+                                                p->rxViews.push_back(view);
+                                                p->rxPkts.push_back(pkt);
+
+                                                if (p->batchSize > 0 && (int)p->rxViews.size() >= p->batchSize)
+                                                {
+                                                    p->flushRxBatch();
+                                                }
+                                            }
+                                            else if (p->tlpCb != NULL)
+                                            {
+                                                p->tlpCb(pcieTlp(pkt, status, p->rxHdr), p->tlpPtr);
+                                            }
+                                            else if (p->userCb != NULL)
+                                            {
+                                                p->userCb(pkt, status, p->userPtr);
+                                            }
+                                            else
+                                            {
+                                                DISCARD_PACKET(pkt);
+                                            }
+                                        };
+
+    unsigned       node;
+
+    callback_t     userCb;
+    void*          userPtr;
+
+    batch_callback_t          batchCb;
+    void*                     batchPtr;
+    int                       batchSize;
+    bool                      inFlush;
+    tlp_callback_t            tlpCb;
+    void*                     tlpPtr;
+    pcieTlpHdr_t              rxHdr;
+    std::vector<pcieRxView_t> rxViews;
+    std::vector<pPkt_t>       rxPkts;
+    std::vector<pcieRxView_t> rxDeliverViews;
+    std::vector<pPkt_t>       rxDeliverPkts;
+
+    pcieReqTracker reqs;
+
+    int            cplPolicy;
+    int            cplRcb;
+    int            cplMps;
+    uint32_t       cplCid;
+    bool           cplDelay;
+    PktData_t      cplBuf[MAX_MPS_BYTES];
+
+    bool           txPending;
+    uint32_t       txCplHdr;               // Credits of the queued completions
+    uint32_t       txCplData;
+
+    uint64_t       rngSeedVal;
+    pcieRng_t      cplRng;
+
+    pcieFcPolicy   fc;
+    pcieAckPolicy  ack;
+    pcieVcArbiter  arb;
+    uint32_t       vcInitTime;
+    pcieShadowMem  shadow;
 
 };
 
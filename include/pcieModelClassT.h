@@ -0,0 +1,124 @@
+// =========================================================================
+//
+//  File Name:         pcieModelClassT.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    Link configuration specialised front end for the PCIe VC model C++
+//    API. The link width, encoding and scrambling, fixed for a PcieModel
+//    instance by its generics, are template parameters. Their values are
+//    checked at compile time, and the template only configures the model
+//    to match and checks them against the PcieModel instance at start-up.
+//    The model library's per-cycle lane processing is prebuilt and is not
+//    specialised, so no run time configuration branches are removed.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <cstdint>
+
+extern "C" {
+#include "pcie.h"
+#include "pcie_vhost_map.h"
+}
+
+#ifndef _PCIEMODELCLASST_H_
+#define _PCIEMODELCLASST_H_
+
+#include "pcieModelClass.h"
+
+// Lane encodings, matching the PcieModel PIPE generic
+#define PCIE_ENC_8B10B                    0
+#define PCIE_ENC_PIPE                     1
+
+template <int Width, int Encoding, bool Scrambled = (Encoding == PCIE_ENC_8B10B)>
+class pcieModelClassT : public pcieModelClass
+{
+    static_assert(Width == 1 || Width == 2 || Width == 4 || Width == 8 || Width == 16,
+                  "pcieModelClassT: link width must be 1, 2, 4, 8 or 16");
+    static_assert(Encoding == PCIE_ENC_8B10B || Encoding == PCIE_ENC_PIPE,
+                  "pcieModelClassT: encoding must be PCIE_ENC_8B10B or PCIE_ENC_PIPE");
+
+public:
+    static const int  linkWidth   = Width;
+    static const bool isPipe      = (Encoding == PCIE_ENC_PIPE);
+    static const bool isScrambled = Scrambled;
+
+               pcieModelClassT         (const unsigned nodeIn) : pcieModelClass(nodeIn) {};
+
+    // Initialise the model, configuring the encoding and scrambling of the specialisation.
+    // Returns false, with an error reported, if the PcieModel instance differs.
+    bool       initialisePcie          (const callback_t cb_func, void *usrptr = NULL)
+    {
+        pcieModelClass::initialisePcie(cb_func, usrptr);
+
+        configurePcie(isPipe      ? CONFIG_DISABLE_8B10B      : CONFIG_ENABLE_8B10B);
+        configurePcie(isScrambled ? CONFIG_ENABLE_SCRAMBLING  : CONFIG_DISABLE_SCRAMBLING);
+
+        return checkConfig();
+    };
+
+    // Check the PcieModel instance generics against the specialisation
+    bool       checkConfig             (void)
+    {
+        unsigned lanes, no8b10b, noscramble;
+
+        VRead(LANESADDR,          &lanes,      1, getNode());
+        VRead(DISABLE_8B10B,      &no8b10b,    1, getNode());
+        VRead(DISABLE_SCRAMBLING, &noscramble, 1, getNode());
+
+        if ((int)lanes < Width || (no8b10b != 0) != isPipe || (noscramble == 0) != isScrambled)
+        {
+            VPrint("pcieModelClassT: ***Error --- x%d %s%s specialisation does not match model (%u lanes, 8b10b %s, scrambling %s) at node %u\n",
+                   Width, isPipe ? "PIPE" : "8b10b", isScrambled ? "" : " unscrambled",
+                   lanes, no8b10b ? "off" : "on", noscramble ? "off" : "on", getNode());
+            return false;
+        }
+
+        return true;
+    };
+
+#if !defined(EXCLUDE_LTSSM) && !defined(OSVVM)
+    // Link initialisation at the specialised width
+    void       initLink                (const int gen = TS_DATA_RATE_GEN1) {pcieModelClass::initLink(Width, gen);};
+#endif
+
+    // Link utilisation summed over the specialised width's lanes
+    uint32_t   readLinkUtilTotal       (const int dir, const int type, const bool lastWindow = false)
+    {
+        uint32_t total = 0;
+
+        for (int lane = 0; lane < Width; lane++)
+        {
+            total += readLinkUtil(dir, lane, type, lastWindow);
+        }
+
+        return total;
+    };
+};
+
+#endif
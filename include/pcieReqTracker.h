@@ -0,0 +1,334 @@
+// =========================================================================
+//
+//  File Name:         pcieReqTracker.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    Non-posted request tag table for the PCIe VC model C++ API. Tags are
+//    allocated from a free list, completions are matched by indexing the
+//    table with the completion's tag, and outstanding requests are limited
+//    and checked for completion timeout.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Added request to completion latency statistics
+//    10/2026   2026.10    Added request address and finished request return
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <cstdint>
+
+extern "C" {
+#include "pcie.h"
+}
+
+#ifndef _PCIEREQTRACKER_H_
+#define _PCIEREQTRACKER_H_
+
+#include "pcieLatencyStats.h"
+
+// Tag table sizes
+#define PCIE_TAG_BITS_5                   5
+#define PCIE_TAG_BITS_8                   8
+#define PCIE_TAG_BITS_10                  10
+#define PCIE_MAX_TAGS                     (1 << PCIE_TAG_BITS_10)
+
+// Default completion timeout, in cycles (50us at the GEN1 symbol rate)
+#define PCIE_DEFAULT_CPL_TIMEOUT          12500
+
+// Request states
+#define PCIE_REQ_PENDING                  0
+#define PCIE_REQ_COMPLETE                 1
+#define PCIE_REQ_TIMEOUT                  2
+
+// -------------------------------------------------------------------------
+// Request handle, owned by the caller and updated as completions arrive.
+// It must remain valid until the request is complete or has timed out.
+// -------------------------------------------------------------------------
+
+typedef struct {
+    uint64_t   addr;         // Request address
+    PktData_t* buf;          // Destination of completion data (NULL to discard)
+    int        length;       // Requested byte count
+    int        received;     // Bytes received so far
+    int        tag;          // Allocated tag
+    int        type;         // Request type for latency statistics (PCIE_LAT_MEM_RD etc.)
+    uint32_t   rid;          // Requester ID
+    int        state;        // PCIE_REQ_PENDING, PCIE_REQ_COMPLETE or PCIE_REQ_TIMEOUT
+    int        cplStatus;    // Status of last completion (CPL_SUCCESS etc.)
+    uint32_t   issueCycle;   // Cycle count when the request was issued
+    uint32_t   cplCycle;     // Cycle count when the final completion arrived
+} pcieRequest_t;
+
+class pcieReqTracker
+{
+public:
+               pcieReqTracker          (void) : tagBits(PCIE_TAG_BITS_8), maxOutstanding(1 << PCIE_TAG_BITS_8),
+                                                cplTimeout(PCIE_DEFAULT_CPL_TIMEOUT), numOutstanding(0), nextTimeout(0)
+                                           {setTagBits(PCIE_TAG_BITS_8);};
+
+    // ---- Configuration ----
+
+    // Select 5, 8 or 10 bit tags. Only valid with no requests outstanding.
+    bool       setTagBits              (const int bits)
+    {
+        if (numOutstanding || (bits != PCIE_TAG_BITS_5 && bits != PCIE_TAG_BITS_8 && bits != PCIE_TAG_BITS_10))
+        {
+            return false;
+        }
+
+        tagBits = bits;
+
+        // Build the free list so that the lowest tags are allocated first. A 10-bit
+        // requester only uses tags with T9:T8 non-zero.
+        numFree = 0;
+        for (int tag = numTags() - 1; tag >= 0; tag--)
+        {
+            table[tag] = NULL;
+
+            if (tag >= firstTag())
+            {
+                freeList[numFree++] = tag;
+            }
+        }
+
+        if (maxOutstanding > numUsableTags())
+        {
+            maxOutstanding = numUsableTags();
+        }
+
+        return true;
+    };
+
+    int        getTagBits              (void)                 {return tagBits;};
+    int        numTags                 (void)                 {return 1 << tagBits;};
+    int        firstTag                (void)                 {return (tagBits == PCIE_TAG_BITS_10) ? (1 << PCIE_TAG_BITS_8) : 0;};
+    int        numUsableTags           (void)                 {return numTags() - firstTag();};
+
+    void       setMaxOutstanding       (const int max)        {maxOutstanding = (max > 0 && max <= numUsableTags()) ? max : numUsableTags();};
+    int        getMaxOutstanding       (void)                 {return maxOutstanding;};
+    int        getNumOutstanding       (void)                 {return numOutstanding;};
+    bool       canIssue                (void)                 {return numOutstanding < maxOutstanding && numFree > 0;};
+
+    void       setCplTimeout           (const uint32_t cycles) {cplTimeout = cycles;};
+    uint32_t   getCplTimeout           (void)                 {return cplTimeout;};
+
+    // ---- Tag allocation ----
+
+    // Allocate a tag for a request, either the next free tag (TLP_TAG_AUTO, or any
+    // negative tag) or the specified tag if it is free. Returns the tag, or -1 if
+    // none available.
+    int        allocate                (pcieRequest_t* req, const int tag, const uint32_t now)
+    {
+        int alloc = -1;
+
+        if (!canIssue())
+        {
+            return -1;
+        }
+
+        if (tag < 0)
+        {
+            alloc = freeList[--numFree];
+        }
+        else if (tag >= firstTag() && tag < numTags() && table[tag] == NULL)
+        {
+            // Remove the specific tag from the free list
+            for (int idx = 0; idx < numFree; idx++)
+            {
+                if (freeList[idx] == tag)
+                {
+                    freeList[idx] = freeList[--numFree];
+                    alloc         = tag;
+                    break;
+                }
+            }
+        }
+
+        if (alloc >= 0)
+        {
+            req->tag        = alloc;
+            req->received   = 0;
+            req->state      = PCIE_REQ_PENDING;
+            req->cplStatus  = CPL_SUCCESS;
+            req->issueCycle = now;
+            req->cplCycle   = now;
+
+            table[alloc]    = req;
+
+            // Track in the outstanding list for timeout checks
+            outIdx[alloc]                 = numOutstanding;
+            outstanding[numOutstanding++] = alloc;
+
+            if (numOutstanding == 1)
+            {
+                nextTimeout = now + cplTimeout;
+            }
+        }
+
+        return alloc;
+    };
+
+    // ---- Completion matching ----
+
+    // Match a received completion TLP against the table. Returns true if the
+    // completion belonged to an outstanding request (and has been consumed),
+    // with the request returned in done if this completion finished it.
+    bool       matchCompletion         (const PktData_t* pkt, const uint32_t now, pcieRequest_t** done = NULL)
+    {
+        int            tag = (tagBits == PCIE_TAG_BITS_10) ? GET_CPL_TAG10(pkt) : GET_CPL_TAG(pkt);
+        pcieRequest_t* req;
+
+        if (tag >= numTags() || (req = table[tag]) == NULL || (uint32_t)GET_CPL_RID(pkt) != req->rid)
+        {
+            return false;
+        }
+
+        int status      = GET_CPL_STATUS(pkt);
+        req->cplStatus  = status;
+
+        if (status == CPL_SUCCESS && (GET_TLP_TYPE(pkt) & TL_TYPE_WRITE))
+        {
+            // Byte count is the remaining bytes, with 0 meaning 4096
+            int remaining = GET_CPL_BYTECOUNT(pkt) ? GET_CPL_BYTECOUNT(pkt) : 4096;
+            int first     = GET_CPL_LOW_ADDR(pkt) & ADDR_DW_OFFSET_MASK;
+            int bytes     = GET_TLP_LENGTH(pkt) * 4 - first;
+            int offset    = req->length - remaining;
+
+            if (bytes > remaining)
+            {
+                bytes = remaining;
+            }
+
+            if (req->buf != NULL && offset >= 0)
+            {
+                const PktData_t* payload = &pkt[TLP_DATA_OFFSETCPL + first];
+
+                for (int idx = 0; idx < bytes && (offset + idx) < req->length; idx++)
+                {
+                    req->buf[offset + idx] = payload[idx];
+                }
+            }
+
+            req->received += bytes;
+
+            // Not the final completion for the request
+            if (bytes < remaining)
+            {
+                return true;
+            }
+        }
+
+        req->cplCycle = now;
+        req->state    = PCIE_REQ_COMPLETE;
+        release(tag);
+
+        lat.record(req->type, now - req->issueCycle);
+
+        if (done != NULL)
+        {
+            *done = req;
+        }
+
+        return true;
+    };
+
+    pcieLatencyStats* getLatencyStats  (void)                 {return &lat;};
+
+    // ---- Timeouts ----
+
+    // Time out any requests outstanding for longer than the completion
+    // timeout. Returns the number of requests timed out. The outstanding
+    // list is only scanned when the earliest deadline has passed.
+    int        checkTimeouts           (const uint32_t now)
+    {
+        int count = 0;
+
+        if (numOutstanding == 0 || (int32_t)(now - nextTimeout) < 0)
+        {
+            return 0;
+        }
+
+        uint32_t earliest = now + cplTimeout;
+
+        for (int idx = 0; idx < numOutstanding; )
+        {
+            int            tag = outstanding[idx];
+            pcieRequest_t* req = table[tag];
+
+            if ((uint32_t)(now - req->issueCycle) >= cplTimeout)
+            {
+                req->state    = PCIE_REQ_TIMEOUT;
+                req->cplCycle = now;
+                release(tag);
+                count++;
+            }
+            else
+            {
+                if ((int32_t)(req->issueCycle + cplTimeout - earliest) < 0)
+                {
+                    earliest = req->issueCycle + cplTimeout;
+                }
+                idx++;
+            }
+        }
+
+        nextTimeout = earliest;
+
+        return count;
+    };
+
+private:
+
+    // Return a tag to the free list and remove from the outstanding list
+    void       release                 (const int tag)
+    {
+        int idx                      = outIdx[tag];
+        int last                     = outstanding[--numOutstanding];
+
+        outstanding[idx]             = last;
+        outIdx[last]                 = idx;
+
+        table[tag]                   = NULL;
+        freeList[numFree++]          = tag;
+    };
+
+    int            tagBits;
+    int            maxOutstanding;
+    uint32_t       cplTimeout;
+
+    int            numFree;
+    int            numOutstanding;
+    uint32_t       nextTimeout;
+
+    pcieRequest_t* table      [PCIE_MAX_TAGS];
+    int            freeList   [PCIE_MAX_TAGS];
+    int            outstanding[PCIE_MAX_TAGS];
+    int            outIdx     [PCIE_MAX_TAGS];
+
+    pcieLatencyStats lat;
+};
+
+#endif
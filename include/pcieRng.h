@@ -0,0 +1,241 @@
+// =========================================================================
+//
+//  File Name:         pcieRng.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    Counter based (Philox4x32-10) random number streams for the PCIe VC
+//    model user code and LTSSM. Each stream is selected by a seed and a
+//    stream ID, so that random decisions for one feature do not perturb
+//    those of another. A stream's position can be jumped ahead, and
+//    bulk fills of payload bytes are generated a batch of blocks at a
+//    time.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#ifndef _PCIERNG_H_
+#define _PCIERNG_H_
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "pcie.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+// -------------------------------------------------------------------------
+// DEFINES
+// -------------------------------------------------------------------------
+
+#define PCIE_RNG_DEFAULT_SEED        0x5eed0000cafef00dULL
+
+// Stream IDs of the model's features. User streams should use IDs from
+// PCIE_RNG_STREAM_USER upwards.
+#define PCIE_RNG_STREAM_LTSSM        1
+#define PCIE_RNG_STREAM_CPL          2
+#define PCIE_RNG_STREAM_TGEN         3
+#define PCIE_RNG_STREAM_PAYLOAD      4
+#define PCIE_RNG_STREAM_USER         0x100
+
+// Stream ID of a feature for a given node
+#define PCIE_RNG_STREAM_ID(_feature, _node) (((uint64_t)(_node) << 32) | (uint32_t)(_feature))
+
+#define PCIE_RNG_ROUNDS              10
+#define PCIE_RNG_BLOCK_WORDS         4
+#define PCIE_RNG_BATCH_BLOCKS        8
+
+#define PCIE_RNG_M0                  0xD2511F53U
+#define PCIE_RNG_M1                  0xCD9E8D57U
+#define PCIE_RNG_W0                  0x9E3779B9U
+#define PCIE_RNG_W1                  0xBB67AE85U
+
+// -------------------------------------------------------------------------
+// TYPEDEFS
+// -------------------------------------------------------------------------
+
+// Stream state. The counter of a block is the stream ID in the top 64 bits
+// and the block number in the bottom 64 bits, keyed with the seed.
+typedef struct {
+    uint32_t key[2];
+    uint64_t stream;
+    uint64_t pos;                             // Number of 32 bit words drawn
+    uint64_t bufBlock;
+    bool     bufValid;
+    uint32_t buf[PCIE_RNG_BLOCK_WORDS];
+} pcieRng_t;
+
+// -------------------------------------------------------------------------
+// FUNCTIONS
+// -------------------------------------------------------------------------
+
+// Philox4x32-10 of a batch of num consecutive blocks from block, with each of
+// the four words of the blocks held in separate arrays so that the rounds
+// are independent across the batch
+static inline void PcieRngBatch (const pcieRng_t* rng, const uint64_t block, const int num, uint32_t out[][PCIE_RNG_BATCH_BLOCKS])
+{
+    uint32_t c0[PCIE_RNG_BATCH_BLOCKS], c1[PCIE_RNG_BATCH_BLOCKS], c2[PCIE_RNG_BATCH_BLOCKS], c3[PCIE_RNG_BATCH_BLOCKS];
+    uint32_t k0 = rng->key[0];
+    uint32_t k1 = rng->key[1];
+    int      r, b;
+
+    for (b = 0; b < num; b++)
+    {
+        c0[b] = (uint32_t)(block + b);
+        c1[b] = (uint32_t)((block + b) >> 32);
+        c2[b] = (uint32_t)rng->stream;
+        c3[b] = (uint32_t)(rng->stream >> 32);
+    }
+
+    for (r = 0; r < PCIE_RNG_ROUNDS; r++)
+    {
+        for (b = 0; b < num; b++)
+        {
+            uint64_t p0 = (uint64_t)PCIE_RNG_M0 * c0[b];
+            uint64_t p1 = (uint64_t)PCIE_RNG_M1 * c2[b];
+
+            c0[b] = (uint32_t)(p1 >> 32) ^ c1[b] ^ k0;
+            c1[b] = (uint32_t)p1;
+            c2[b] = (uint32_t)(p0 >> 32) ^ c3[b] ^ k1;
+            c3[b] = (uint32_t)p0;
+        }
+
+        k0 += PCIE_RNG_W0;
+        k1 += PCIE_RNG_W1;
+    }
+
+    for (b = 0; b < num; b++)
+    {
+        out[0][b] = c0[b];
+        out[1][b] = c1[b];
+        out[2][b] = c2[b];
+        out[3][b] = c3[b];
+    }
+}
+
+// Select the stream of a seed and stream ID, from its start
+static inline void PcieRngInit (pcieRng_t* rng, const uint64_t seed, const uint64_t stream)
+{
+    rng->key[0]   = (uint32_t)seed;
+    rng->key[1]   = (uint32_t)(seed >> 32);
+    rng->stream   = stream;
+    rng->pos      = 0;
+    rng->bufValid = false;
+}
+
+// Next 32 bit random number of the stream
+static inline uint32_t PcieRngNext (pcieRng_t* rng)
+{
+    uint64_t block = rng->pos / PCIE_RNG_BLOCK_WORDS;
+
+    if (!rng->bufValid || rng->bufBlock != block)
+    {
+        uint32_t out[PCIE_RNG_BLOCK_WORDS][PCIE_RNG_BATCH_BLOCKS];
+        int      w;
+
+        PcieRngBatch(rng, block, 1, out);
+
+        for (w = 0; w < PCIE_RNG_BLOCK_WORDS; w++)
+        {
+            rng->buf[w] = out[w][0];
+        }
+
+        rng->bufBlock = block;
+        rng->bufValid = true;
+    }
+
+    return rng->buf[rng->pos++ % PCIE_RNG_BLOCK_WORDS];
+}
+
+// Skip the next count numbers of the stream
+static inline void PcieRngJump (pcieRng_t* rng, const uint64_t count)
+{
+    rng->pos += count;
+}
+
+// Fill length bytes of packet data with random bytes, drawing one number from
+// the stream for every four bytes (or part thereof), least significant byte
+// first, so that the stream position is the same as for PcieRngNext() calls
+static inline void PcieRngFill (pcieRng_t* rng, PktData_t* data, const int length)
+{
+    uint32_t out[PCIE_RNG_BLOCK_WORDS][PCIE_RNG_BATCH_BLOCKS];
+    int      idx = 0;
+    int      b, w, k;
+
+    // Whole blocks are generated a batch at a time once at a block boundary
+    while (length - idx >= PCIE_RNG_BLOCK_WORDS * 4 && (rng->pos % PCIE_RNG_BLOCK_WORDS) == 0)
+    {
+        int num = (length - idx) / (PCIE_RNG_BLOCK_WORDS * 4);
+
+        num = (num < PCIE_RNG_BATCH_BLOCKS) ? num : PCIE_RNG_BATCH_BLOCKS;
+
+        PcieRngBatch(rng, rng->pos / PCIE_RNG_BLOCK_WORDS, num, out);
+
+        for (b = 0; b < num; b++)
+        {
+            for (w = 0; w < PCIE_RNG_BLOCK_WORDS; w++)
+            {
+                for (k = 0; k < 4; k++)
+                {
+                    data[idx++] = (out[w][b] >> (8 * k)) & 0xff;
+                }
+            }
+        }
+
+        rng->pos += (uint64_t)num * PCIE_RNG_BLOCK_WORDS;
+    }
+
+    // Unaligned and trailing bytes
+    while (idx < length)
+    {
+        uint32_t word = PcieRngNext(rng);
+
+        for (k = 0; k < 4 && idx < length; k++)
+        {
+            data[idx++] = (word >> (8 * k)) & 0xff;
+        }
+
+        // Continue in batches if now at a block boundary
+        if ((rng->pos % PCIE_RNG_BLOCK_WORDS) == 0 && length - idx >= PCIE_RNG_BLOCK_WORDS * 4)
+        {
+            PcieRngFill(rng, &data[idx], length - idx);
+            return;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,191 @@
+// =========================================================================
+//
+//  File Name:         pcieShadowMem.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    Shadow of expected target memory for the PCIe VC model C++ API.
+//    Bytes written by issued memory writes are recorded in 4KB pages with
+//    a validity mask, and read completion data is compared against them
+//    in a single branch free pass per page, with only mismatches and
+//    counts reported.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <cstdint>
+#include <unordered_map>
+
+extern "C" {
+#include "pcie.h"
+}
+
+#ifndef _PCIESHADOWMEM_H_
+#define _PCIESHADOWMEM_H_
+
+#define PCIE_SHADOW_PAGE_BYTES            4096
+#define PCIE_SHADOW_BYTE_VALID            0xff
+
+class pcieShadowMem
+{
+public:
+               pcieShadowMem           (void) : enabled(false), report(true) {resetStats();};
+
+    // ---- Configuration ----
+
+    void       setEnabled              (const bool en)        {enabled = en;};
+    bool       isEnabled               (void)                 {return enabled;};
+
+    // Report each mismatching read with VPrint
+    void       setReport               (const bool en)        {report = en;};
+
+    // Forget all the expected data
+    void       clear                   (void)                 {pages.clear();};
+
+    // ---- Update and check ----
+
+    // Record the bytes of an issued memory write
+    void       write                   (const uint64_t addr, const PktData_t* data, const int length)
+    {
+        for (int offset = 0; offset < length; )
+        {
+            page_t*  pg    = &pages[(addr + offset) / PCIE_SHADOW_PAGE_BYTES];
+            int      start = (int)((addr + offset) % PCIE_SHADOW_PAGE_BYTES);
+            int      bytes = pageChunk(start, length - offset);
+
+            for (int idx = 0; idx < bytes; idx++)
+            {
+                pg->data[start + idx] = data[offset + idx] & BYTE_MASK;
+                pg->mask[start + idx] = PCIE_SHADOW_BYTE_VALID;
+            }
+
+            offset += bytes;
+        }
+    };
+
+    // Compare read data against the expected bytes, returning the number of mismatching
+    // bytes. Bytes never written are not checked.
+    int        check                   (const uint64_t addr, const PktData_t* data, const int length, const int node)
+    {
+        int mismatches = 0;
+
+        for (int offset = 0; offset < length; )
+        {
+            int start = (int)((addr + offset) % PCIE_SHADOW_PAGE_BYTES);
+            int bytes = pageChunk(start, length - offset);
+
+            std::unordered_map<uint64_t, page_t>::iterator it = pages.find((addr + offset) / PCIE_SHADOW_PAGE_BYTES);
+
+            if (it != pages.end())
+            {
+                const PktData_t* exp  = &it->second.data[start];
+                const PktData_t* mask = &it->second.mask[start];
+                const PktData_t* act  = &data[offset];
+                int              bad  = 0;
+
+                for (int idx = 0; idx < bytes; idx++)
+                {
+                    bad += ((act[idx] ^ exp[idx]) & mask[idx]) != 0;
+                }
+
+                if (bad && report && mismatches == 0)
+                {
+                    reportFirst(addr + offset, exp, mask, act, bytes, node);
+                }
+
+                mismatches += bad;
+            }
+
+            offset += bytes;
+        }
+
+        numChecks++;
+        numBytesChecked += length;
+
+        if (mismatches)
+        {
+            numMismatchReads++;
+            numMismatchBytes += mismatches;
+        }
+
+        return mismatches;
+    };
+
+    // ---- Statistics ----
+
+    uint32_t   getNumChecks            (void)                 {return numChecks;};
+    uint64_t   getNumBytesChecked      (void)                 {return numBytesChecked;};
+    uint32_t   getNumMismatchReads     (void)                 {return numMismatchReads;};
+    uint64_t   getNumMismatchBytes     (void)                 {return numMismatchBytes;};
+
+    void       resetStats              (void)
+    {
+        numChecks        = 0;
+        numBytesChecked  = 0;
+        numMismatchReads = 0;
+        numMismatchBytes = 0;
+    };
+
+private:
+
+    typedef struct {
+        PktData_t data[PCIE_SHADOW_PAGE_BYTES];
+        PktData_t mask[PCIE_SHADOW_PAGE_BYTES];   // PCIE_SHADOW_BYTE_VALID for bytes written, else 0
+    } page_t;
+
+    int        pageChunk               (const int start, const int remaining)
+    {
+        int bytes = PCIE_SHADOW_PAGE_BYTES - start;
+        return (bytes < remaining) ? bytes : remaining;
+    };
+
+    void       reportFirst             (const uint64_t addr, const PktData_t* exp, const PktData_t* mask, const PktData_t* act,
+                                        const int bytes, const int node)
+    {
+        for (int idx = 0; idx < bytes; idx++)
+        {
+            if ((act[idx] ^ exp[idx]) & mask[idx])
+            {
+                VPrint("PCIe shadow memory mismatch at 0x%016llx: expected 0x%02x, read 0x%02x (node %d)\n",
+                       (unsigned long long)(addr + idx), exp[idx], act[idx] & BYTE_MASK, node);
+                return;
+            }
+        }
+    };
+
+    bool                                 enabled;
+    bool                                 report;
+
+    std::unordered_map<uint64_t, page_t> pages;
+
+    uint32_t                             numChecks;
+    uint64_t                             numBytesChecked;
+    uint32_t                             numMismatchReads;
+    uint64_t                             numMismatchBytes;
+};
+
+#endif
@@ -0,0 +1,131 @@
+// =========================================================================
+//
+//  File Name:         pcieTlp.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    Move-only owning handle for packets received from the PCIe model,
+//    for the PCIe VC model C++ API. The packet is discarded when the
+//    handle is destroyed, and can be moved into queues and scoreboards
+//    without copying. The decoded header is held with the packet, and
+//    the header and payload bytes are accessible as spans (C++20) or
+//    as pointer and length.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <cstdint>
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+
+extern "C" {
+#include "pcie.h"
+}
+
+#ifndef _PCIETLP_H_
+#define _PCIETLP_H_
+
+#include "pcieTlpHdr.h"
+
+class pcieTlp
+{
+public:
+               pcieTlp                 (void) : pkt(NULL), pktStatus(PKT_STATUS_GOOD), hdr() {};
+
+    // Take ownership of a received packet, decoding its header if a TLP
+    explicit   pcieTlp                 (pPkt_t pktIn, const int status = PKT_STATUS_GOOD) : pkt(pktIn), pktStatus(status), hdr()
+                                           {if (isTlp()) pcieDecodeTlpHdr(pkt->data, hdr);};
+
+    // Take ownership of a received packet with its already decoded header
+               pcieTlp                 (pPkt_t pktIn, const int status, const pcieTlpHdr_t &hdrIn) : pkt(pktIn), pktStatus(status), hdr(hdrIn) {};
+
+               pcieTlp                 (pcieTlp &&other) : pkt(other.pkt), pktStatus(other.pktStatus), hdr(other.hdr) {other.pkt = NULL;};
+
+               pcieTlp                 (const pcieTlp &)      = delete;
+    pcieTlp&   operator=               (const pcieTlp &)      = delete;
+
+    pcieTlp&   operator=               (pcieTlp &&other)
+    {
+        if (this != &other)
+        {
+            reset();
+            pkt       = other.pkt;
+            pktStatus = other.pktStatus;
+            hdr       = other.hdr;
+            other.pkt = NULL;
+        }
+        return *this;
+    };
+
+              ~pcieTlp                 ()                     {reset();};
+
+    // ---- Ownership ----
+
+    // Discard the packet now
+    void       reset                   (void)
+    {
+        if (pkt != NULL)
+        {
+            DISCARD_PACKET(pkt);
+            pkt = NULL;
+        }
+    };
+
+    // Give up ownership, returning the packet, which must then be discarded with DISCARD_PACKET
+    pPkt_t     release                 (void)                 {pPkt_t p = pkt; pkt = NULL; return p;};
+
+    pPkt_t     get                     (void) const           {return pkt;};
+    explicit   operator bool           (void) const           {return pkt != NULL;};
+
+    // ---- Packet ----
+
+    const PktData_t*    data           (void) const           {return pkt ? pkt->data : NULL;};
+    int                 status         (void) const           {return pktStatus;};
+    int                 seq            (void) const           {return pkt ? pkt->seq : DLLP_SEQ_ID;};
+    uint32_t            timeStamp      (void) const           {return pkt ? pkt->TimeStamp : 0;};
+    bool                isTlp          (void) const           {return pkt != NULL && pkt->seq != DLLP_SEQ_ID;};
+    const pcieTlpHdr_t& header         (void) const           {return hdr;};
+
+    // Header bytes (12 or 16) and payload bytes of a TLP
+    const PktData_t*    headerPtr      (void) const           {return isTlp() ? &pkt->data[TLP_TYPE_BYTE_OFFSET] : NULL;};
+    int                 headerBytes    (void) const           {return isTlp() ? (hdr.is4dw ? 16 : 12) : 0;};
+    const PktData_t*    payloadPtr     (void) const           {return isTlp() ? &pkt->data[hdr.payloadOffset] : NULL;};
+    int                 payloadBytes   (void) const           {return (isTlp() && hdr.hasData) ? hdr.length * 4 : 0;};
+
+#if __cplusplus >= 202002L
+    std::span<const PktData_t> headerSpan  (void) const       {return std::span<const PktData_t>(headerPtr(),  (size_t)headerBytes());};
+    std::span<const PktData_t> payloadSpan (void) const       {return std::span<const PktData_t>(payloadPtr(), (size_t)payloadBytes());};
+#endif
+
+private:
+    pPkt_t       pkt;
+    int          pktStatus;
+    pcieTlpHdr_t hdr;
+};
+
+#endif
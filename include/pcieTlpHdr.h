@@ -0,0 +1,108 @@
+// =========================================================================
+//
+//  File Name:         pcieTlpHdr.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    Pre-parsed TLP header for the PCIe VC model C++ API. A received
+//    TLP's header fields are decoded once from the packet byte array
+//    into a compact structure, in place of repeated use of the
+//    GET_TLP_* and GET_CPL_* macros by each consumer.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <cstdint>
+
+extern "C" {
+#include "pcie.h"
+}
+
+#ifndef _PCIETLPHDR_H_
+#define _PCIETLPHDR_H_
+
+// Decoded TLP header. Fields not present in the TLP's header format are 0.
+typedef struct {
+    int       type;              // Format and type byte, as GET_TLP_TYPE
+    bool      is4dw;
+    bool      isCpl;
+    bool      hasData;
+    bool      digest;
+    bool      poisoned;
+    int       tc;
+    int       attr;
+    int       length;            // Length field in DWORDs (1024 for a field of 0)
+    uint64_t  addr;              // Request address, or lower address for completions
+    uint32_t  rid;               // Requester ID
+    uint32_t  cid;               // Completer ID of completions
+    int       tag;               // Tag, including 10 bit tag bits
+    int       fbe;
+    int       lbe;
+    int       cplStatus;
+    int       byteCount;         // Completion remaining byte count (4096 for a field of 0)
+    int       payloadOffset;     // Index of the first payload byte in the packet data
+} pcieTlpHdr_t;
+
+// Decode a TLP's header from its packet data
+inline void pcieDecodeTlpHdr (const PktData_t* pkt, pcieTlpHdr_t &hdr)
+{
+    hdr.type          = GET_TLP_TYPE(pkt);
+    hdr.is4dw         = TLP_HDR_4DW(pkt);
+    hdr.isCpl         = (hdr.type & 0x3e) == TL_CPL;
+    hdr.hasData       = (hdr.type & TL_TYPE_WRITE) != 0;
+    hdr.digest        = TLP_HAS_DIGEST(pkt);
+    hdr.poisoned      = (pkt[TLP_EP_BYTE_OFFSET] & TLP_EP_BYTE_MASK) != 0;
+    hdr.tc            = GET_TLP_TC(pkt);
+    hdr.attr          = (pkt[TLP_ATTR_BYTE_OFFSET] & TLP_ATTR_BYTE_MASK) >> 4;
+    hdr.length        = GET_TLP_LENGTH(pkt);
+    hdr.payloadOffset = hdr.is4dw ? TLP_DATA_OFFSET64 : TLP_DATA_OFFSET32;
+
+    if (hdr.isCpl)
+    {
+        hdr.addr      = GET_CPL_LOW_ADDR(pkt);
+        hdr.rid       = GET_CPL_RID(pkt);
+        hdr.cid       = GET_CPL_CID(pkt);
+        hdr.tag       = GET_CPL_TAG10(pkt);
+        hdr.fbe       = 0;
+        hdr.lbe       = 0;
+        hdr.cplStatus = GET_CPL_STATUS(pkt);
+        hdr.byteCount = GET_CPL_BYTECOUNT(pkt) ? GET_CPL_BYTECOUNT(pkt) : 4096;
+    }
+    else
+    {
+        hdr.addr      = GET_TLP_ADDRESS(pkt);
+        hdr.rid       = GET_TLP_RID(pkt);
+        hdr.cid       = 0;
+        hdr.tag       = GET_TAG10_HI(pkt) | GET_TLP_TAG(pkt);
+        hdr.fbe       = GET_TLP_FBE(pkt);
+        hdr.lbe       = GET_TLP_LBE(pkt);
+        hdr.cplStatus = 0;
+        hdr.byteCount = 0;
+    }
+}
+
+#endif
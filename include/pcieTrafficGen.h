@@ -0,0 +1,329 @@
+// =========================================================================
+//
+//  File Name:         pcieTrafficGen.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    Autonomous memory traffic generator for the PCIe VC model C++ API.
+//    Configured once with a write/read mix, address range, length range,
+//    target rate and outstanding read limit, it generates memory writes
+//    and non-blocking reads for a number of transactions or cycles,
+//    checking read data against the data it has written, and returns
+//    summary statistics.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Use own random streams for choices and payloads
+//    10/2026   2026.10    Written data held in shadow memory
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <cstdint>
+#include <cstdio>
+#include <list>
+#include <vector>
+
+extern "C" {
+#include "pcie.h"
+}
+
+#ifndef _PCIETRAFFICGEN_H_
+#define _PCIETRAFFICGEN_H_
+
+#include "pcieModelClass.h"
+#include "pcieShadowMem.h"
+
+// Page boundary that generated TLPs do not cross
+#define PCIE_TGEN_PAGE_BYTES              4096
+
+// Summary statistics of a traffic generator run
+typedef struct {
+    uint32_t numWrites;
+    uint32_t numReads;
+    uint64_t bytesWritten;
+    uint64_t bytesRead;
+    uint32_t numMismatches;      // Reads with data not matching that written
+    uint32_t numFailed;          // Reads timed out or completed with a bad status
+    uint32_t startCycle;
+    uint32_t endCycle;
+} pcieTrafficStats_t;
+
+class pcieTrafficGen
+{
+public:
+               pcieTrafficGen          (pcieModelClass* modelIn, const uint32_t ridIn = 0) :
+                                           model(modelIn), rid(ridIn), wrWeight(1), rdWeight(1),
+                                           addrBase(0), addrSize(PCIE_TGEN_PAGE_BYTES), minLen(4), maxLen(DEFAULT_MPS_BYTES),
+                                           rateTlps(0), rateCycles(1), checkData(true)
+                                           {
+                                               model->rngStream(&rng,     PCIE_RNG_STREAM_TGEN);
+                                               model->rngStream(&payload, PCIE_RNG_STREAM_PAYLOAD);
+                                               resetStats();
+                                           };
+
+    // ---- Configuration ----
+
+    // Relative weights of memory writes and reads
+    void       setMix                  (const uint32_t wr, const uint32_t rd) {wrWeight = wr; rdWeight = (wr || rd) ? rd : 1;};
+
+    void       setAddrRange            (const uint64_t base, const uint64_t size) {addrBase = base; addrSize = size ? size : 1;};
+
+    // Range of uniformly distributed lengths in bytes, limited by max payload size
+    // for writes and max read request size for reads
+    void       setLength               (const int min, const int max)
+    {
+        minLen = (min > 0) ? min : 1;
+        maxLen = (max >= minLen) ? max : minLen;
+    };
+
+    // Target rate of tlps TLPs every cycles cycles (tlps of 0 for back-to-back)
+    void       setRate                 (const uint32_t tlps, const uint32_t cycles) {rateTlps = tlps; rateCycles = cycles ? cycles : 1;};
+
+    void       setMaxOutstanding       (const int max)        {model->setMaxOutstanding(max);};
+    void       setCheck                (const bool en)        {checkData = en;};
+
+    // Restart the generator's random streams from the model's current seed
+    void       reseed                  (void)
+    {
+        model->rngStream(&rng,     PCIE_RNG_STREAM_TGEN);
+        model->rngStream(&payload, PCIE_RNG_STREAM_PAYLOAD);
+    };
+
+    // ---- Generation ----
+
+    // Generate numTrans transactions, or until maxCycles cycles have elapsed if non-zero,
+    // then wait for all reads to finish. Returns true if all reads completed and checked
+    // without error.
+    bool       run                     (const uint32_t numTrans, const uint32_t maxCycles = 0)
+    {
+        uint32_t issued = 0;
+        int      mps    = model->getMaxPayloadSize();
+        int      mrrs   = model->getMaxReadReqSize();
+
+        stats.startCycle = model->getCycleCount();
+
+        while (issued < numTrans && (maxCycles == 0 || elapsed() < maxCycles))
+        {
+            retire();
+
+            // Hold off until the target rate allows the next TLP
+            if (rateTlps && (uint64_t)issued * rateCycles > (uint64_t)elapsed() * rateTlps)
+            {
+                model->sendIdle(1);
+                continue;
+            }
+
+            bool     write = (PcieRngNext(&rng) % (wrWeight + rdWeight)) < wrWeight;
+            int      len   = pickLength(write ? mps : mrrs);
+            uint64_t addr  = pickAddr(len);
+
+            // Reads wait for a free tag, and writes for earlier reads of the same bytes
+            if (write ? overlapsInflight(addr, len) : !model->canIssue())
+            {
+                model->sendIdle(1);
+                continue;
+            }
+
+            if (write)
+            {
+                genWrite(addr, len);
+            }
+            else
+            {
+                genRead(addr, len);
+            }
+
+            issued++;
+        }
+
+        model->waitForAllRequests();
+        retire();
+
+        stats.endCycle = model->getCycleCount();
+
+        return stats.numMismatches == 0 && stats.numFailed == 0;
+    };
+
+    // Forget all data written, so that later reads are not checked against it
+    void       clearShadow             (void)                 {shadow.clear();};
+
+    // ---- Statistics ----
+
+    pcieTrafficStats_t getStats        (void)                 {return stats;};
+
+    void       resetStats              (void)
+    {
+        stats.numWrites     = 0;
+        stats.numReads      = 0;
+        stats.bytesWritten  = 0;
+        stats.bytesRead     = 0;
+        stats.numMismatches = 0;
+        stats.numFailed     = 0;
+        stats.startCycle    = 0;
+        stats.endCycle      = 0;
+    };
+
+    void       dump                    (FILE* fp)
+    {
+        uint32_t cycles = stats.endCycle - stats.startCycle;
+
+        fprintf(fp, "Traffic generator: %u writes (%llu bytes), %u reads (%llu bytes) in %u cycles, %u mismatches, %u failed\n",
+                    stats.numWrites, (unsigned long long)stats.bytesWritten, stats.numReads, (unsigned long long)stats.bytesRead,
+                    cycles, stats.numMismatches, stats.numFailed);
+    };
+
+private:
+
+    // Outstanding read. Writes to its bytes are held off until it has finished, so
+    // the data expected is that in the shadow memory when it is retired.
+    typedef struct {
+        pcieRequest_t          req;
+        uint64_t               addr;
+        int                    len;
+        std::vector<PktData_t> buf;
+    } inflight_t;
+
+    uint32_t   elapsed                 (void)                 {return model->getCycleCount() - stats.startCycle;};
+
+    int        pickLength              (const int limit)
+    {
+        int max = (maxLen < limit) ? maxLen : limit;
+        int min = (minLen < max)   ? minLen : max;
+
+        return min + (int)(PcieRngNext(&rng) % (uint32_t)(max - min + 1));
+    };
+
+    // Random address in range, with the length trimmed so as not to cross a page or the range end
+    uint64_t   pickAddr                (int &len)
+    {
+        uint64_t hi   = PcieRngNext(&rng);
+        uint64_t addr = addrBase + (((hi << 32) | PcieRngNext(&rng)) % addrSize);
+        uint64_t page = PCIE_TGEN_PAGE_BYTES - (addr % PCIE_TGEN_PAGE_BYTES);
+        uint64_t end  = addrBase + addrSize - addr;
+
+        if ((uint64_t)len > page) len = (int)page;
+        if ((uint64_t)len > end)  len = (int)end;
+
+        return addr;
+    };
+
+    bool       overlapsInflight        (const uint64_t addr, const int len)
+    {
+        for (std::list<inflight_t>::iterator it = inflight.begin(); it != inflight.end(); it++)
+        {
+            if (addr < it->addr + it->len && it->addr < addr + len)
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    void       genWrite                (const uint64_t addr, const int len)
+    {
+        std::vector<PktData_t> data(len);
+
+        PcieRngFill(&payload, data.data(), len);
+
+        if (checkData)
+        {
+            shadow.write(addr, data.data(), len);
+        }
+
+        model->memWrite(addr, data.data(), len, 0, rid);
+
+        stats.numWrites++;
+        stats.bytesWritten += len;
+    };
+
+    void       genRead                 (const uint64_t addr, const int len)
+    {
+        inflight.push_back(inflight_t());
+
+        inflight_t* r = &inflight.back();
+
+        r->addr = addr;
+        r->len  = len;
+        r->buf.resize(len);
+
+        if (model->memReadAsync(addr, r->buf.data(), len, rid, &r->req) < 0)
+        {
+            inflight.pop_back();
+            stats.numFailed++;
+            return;
+        }
+
+        stats.numReads++;
+        stats.bytesRead += len;
+    };
+
+    // Check and remove finished reads
+    void       retire                  (void)
+    {
+        model->checkTimeouts();
+
+        for (std::list<inflight_t>::iterator it = inflight.begin(); it != inflight.end(); )
+        {
+            if (!model->isComplete(&it->req))
+            {
+                it++;
+                continue;
+            }
+
+            if (it->req.state != PCIE_REQ_COMPLETE || it->req.cplStatus != CPL_SUCCESS)
+            {
+                stats.numFailed++;
+            }
+            else if (checkData && shadow.check(it->addr, it->buf.data(), it->len, model->getNode()))
+            {
+                stats.numMismatches++;
+            }
+
+            it = inflight.erase(it);
+        }
+    };
+
+    pcieModelClass*                         model;
+    uint32_t                                rid;
+
+    uint32_t                                wrWeight;
+    uint32_t                                rdWeight;
+    uint64_t                                addrBase;
+    uint64_t                                addrSize;
+    int                                     minLen;
+    int                                     maxLen;
+    uint32_t                                rateTlps;
+    uint32_t                                rateCycles;
+    bool                                    checkData;
+
+    pcieRng_t                               rng;
+    pcieRng_t                               payload;
+
+    std::list<inflight_t>                   inflight;
+    pcieShadowMem                           shadow;
+    pcieTrafficStats_t                      stats;
+};
+
+#endif
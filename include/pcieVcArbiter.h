@@ -0,0 +1,349 @@
+// =========================================================================
+//
+//  File Name:         pcieVcArbiter.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    Virtual channel support for the PCIe VC model C++ API. TLPs are
+//    mapped from their traffic class to a virtual channel and held in
+//    per-VC transmit queues, with VC arbitration being round robin or
+//    weighted round robin. Transmit credits for VC1 to VC7 are tracked
+//    from the link partner's flow control DLLPs, and received credits
+//    for those VCs are returned as they are consumed. VC0 transmit
+//    credits are checked with the model class's flow control policy,
+//    which leaves them with the model under PCIE_FC_POLICY_MODEL.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Added check for enabled VCs above VC0
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+
+extern "C" {
+#include "pcie.h"
+}
+
+#ifndef _PCIEVCARBITER_H_
+#define _PCIEVCARBITER_H_
+
+#include "pcieFcPolicy.h"
+
+// VC arbitration schemes
+#define PCIE_VC_ARB_RR                    0
+#define PCIE_VC_ARB_WRR                   1
+
+#define PCIE_NUM_TCS                      8
+
+// Default cycles sendVc() waits without progress for VC credits (50us at the GEN1 symbol rate)
+#define PCIE_VC_DEFAULT_TIMEOUT           12500
+
+// Queued TLP. The generator is called when the TLP wins arbitration and
+// returns the queued packet, so that its TC can be set before sending.
+typedef struct {
+    std::function<pPktData_t(void)> gen;
+    int                             tc;
+    int                             fctype;
+    uint32_t                        hdr;
+    uint32_t                        data;
+} pcieVcTlp_t;
+
+class pcieVcArbiter
+{
+public:
+               pcieVcArbiter           (pcieFcPolicy* vc0FcIn = NULL) : vc0Fc(vc0FcIn), arbitration(PCIE_VC_ARB_RR), current(0), grants(0)
+                                           {
+                                               for (int tc = 0; tc < PCIE_NUM_TCS; tc++)
+                                               {
+                                                   tcMap[tc] = 0;
+                                               }
+
+                                               for (int vc = 0; vc < MAX_VIRTUAL_CHANNELS; vc++)
+                                               {
+                                                   weight[vc]  = 1;
+                                                   enabled[vc] = (vc == 0);
+                                                   startFcInit(vc);
+                                                   for (int type = 0; type < FC_NUMTYPES; type++)
+                                                   {
+                                                       setRxCredits(vc, type, FC_INFINITE_CREDITS, FC_INFINITE_CREDITS);
+                                                   }
+                                               }
+                                           };
+
+    // ---- Configuration ----
+
+    void       setTcVc                 (const int tc, const int vc)     {tcMap[tc & (PCIE_NUM_TCS-1)] = vc & DL_VC_BITS;};
+    int        getVc                   (const int tc)                   {return tcMap[tc & (PCIE_NUM_TCS-1)];};
+
+    void       setArbitration          (const int arb)                  {arbitration = arb;};
+    void       setWeight               (const int vc, const int w)      {weight[vc & DL_VC_BITS] = (w > 0) ? w : 1;};
+
+    void       setEnabled              (const int vc, const bool en)    {enabled[vc & DL_VC_BITS] = en || vc == 0;};
+    bool       isEnabled               (const int vc)                   {return enabled[vc & DL_VC_BITS];};
+
+    // True if any of VC1 to VC7 is enabled
+    bool       hasVcs                  (void)
+    {
+        for (int vc = 1; vc < MAX_VIRTUAL_CHANNELS; vc++)
+        {
+            if (enabled[vc])
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // Received credits advertised for a VC (0 for infinite)
+    void       setRxCredits            (const int vc, const int type, const uint32_t hdr, const uint32_t data)
+    {
+        rx[vc][type].initHdr  = hdr;
+        rx[vc][type].initData = data;
+        rx[vc][type].hdr      = 0;
+        rx[vc][type].data     = 0;
+    };
+
+    uint32_t   getRxInitHdr            (const int vc, const int type)   {return rx[vc][type].initHdr;};
+    uint32_t   getRxInitData           (const int vc, const int type)   {return rx[vc][type].initData;};
+
+    // ---- Transmit queueing and arbitration ----
+
+    void       enqueue                 (const pcieVcTlp_t &tlp)         {queue[tcMap[tlp.tc & (PCIE_NUM_TCS-1)]].push_back(tlp);};
+
+    bool       isEmpty                 (void)
+    {
+        for (int vc = 0; vc < MAX_VIRTUAL_CHANNELS; vc++)
+        {
+            if (!queue[vc].empty())
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Select the next TLP to send, returning false if all the queues are empty or blocked
+    // for credits. The current VC keeps the grant for up to its weight in TLPs under WRR.
+    bool       next                    (pcieVcTlp_t &tlp)
+    {
+        for (int count = 0; count <= MAX_VIRTUAL_CHANNELS; count++)
+        {
+            int vc    = current;
+            int limit = (arbitration == PCIE_VC_ARB_WRR) ? weight[vc] : 1;
+
+            if (!queue[vc].empty() && hasCredits(vc, queue[vc].front()))
+            {
+                tlp = queue[vc].front();
+                queue[vc].pop_front();
+                consume(vc, tlp);
+
+                if (++grants >= limit)
+                {
+                    advance();
+                }
+
+                return true;
+            }
+
+            advance();
+        }
+
+        return false;
+    };
+
+    // ---- Flow control ----
+
+    // Process a received flow control DLLP for VC1 to VC7
+    void       fcDllp                  (const PktData_t* pkt)
+    {
+        int vc     = GET_DLLP_VC(pkt);
+        int type   = GET_DLLP_TYPE(pkt);
+        int kind   = type & 0xc0;                        // InitFC1, InitFC2 or UpdateFC
+        int fctype = (type >> 4) & 0x3;
+
+        if (vc == 0 || kind == 0 || fctype >= FC_NUMTYPES)
+        {
+            return;
+        }
+
+        fcTx_t* s = &tx[vc][fctype];
+
+        // The first InitFC values are the initial credit limits, with UpdateFCs ignored until then
+        if (!s->init)
+        {
+            if (kind == (DL_UPDATEFC_P & 0xc0))
+            {
+                return;
+            }
+
+            s->init     = true;
+            s->infHdr   = GET_HDR_FC(pkt)  == FC_INFINITE_CREDITS;
+            s->infData  = GET_DATA_FC(pkt) == FC_INFINITE_CREDITS;
+            s->consHdr  = 0;
+            s->consData = 0;
+        }
+
+        s->fi2 = s->fi2 || kind != (DL_INITFC1_P & 0xc0);
+
+        s->limitHdr  = GET_HDR_FC(pkt);
+        s->limitData = GET_DATA_FC(pkt);
+    };
+
+    // Restart flow control initialisation of a VC
+    void       startFcInit             (const int vc)
+    {
+        fi2Sent[vc] = false;
+        for (int type = 0; type < FC_NUMTYPES; type++)
+        {
+            tx[vc][type].init = false;
+            tx[vc][type].fi2  = false;
+        }
+    };
+
+    // Flow control initialisation DLLP to send for VC1 to VC7: InitFC1 until the link partner's
+    // InitFCs for all types are seen, then InitFC2 until its InitFC2s or UpdateFCs are seen and
+    // at least one set of InitFC2s has been sent, or 0 once initialisation is done
+    int        fcInitKind              (const int vc)
+    {
+        bool fi1 = true;
+        bool fi2 = true;
+
+        for (int type = 0; type < FC_NUMTYPES; type++)
+        {
+            fi1 = fi1 && tx[vc][type].init;
+            fi2 = fi2 && tx[vc][type].fi2;
+        }
+
+        return !fi1                   ? DL_INITFC1_P :
+               (!fi2 || !fi2Sent[vc]) ? DL_INITFC2_P : 0;
+    };
+
+    void       fcInitSent              (const int vc, const int kind)   {fi2Sent[vc] = fi2Sent[vc] || kind == DL_INITFC2_P;};
+
+    bool       isFcInitDone            (const int vc)                   {return vc == 0 || fcInitKind(vc & DL_VC_BITS) == 0;};
+
+    // Account for a received TLP on VC1 to VC7, returning true with the new credit limits
+    // when they are to be returned to the link partner
+    bool       rxTlp                   (const PktData_t* pkt, int &vc, int &type, uint32_t &hdrfc, uint32_t &datafc)
+    {
+        vc   = getVc(GET_TLP_TC(pkt));
+        type = pcieFcPolicy::fcType(pkt);
+
+        fcRx_t* s = &rx[vc][type];
+
+        if (vc == 0 || (s->initHdr == FC_INFINITE_CREDITS && s->initData == FC_INFINITE_CREDITS))
+        {
+            return false;
+        }
+
+        s->hdr  += 1;
+        s->data += pcieFcPolicy::fcDataCredits(pkt);
+
+        hdrfc    = s->initHdr  ? (s->initHdr  + s->hdr)  & FC_HDR_CREDIT_MASK  : FC_INFINITE_CREDITS;
+        datafc   = s->initData ? (s->initData + s->data) & FC_DATA_CREDIT_MASK : FC_INFINITE_CREDITS;
+
+        return true;
+    };
+
+private:
+
+    typedef struct {
+        bool     init;
+        bool     fi2;                // InitFC2 or UpdateFC seen
+        bool     infHdr;
+        bool     infData;
+        uint32_t limitHdr;
+        uint32_t limitData;
+        uint32_t consHdr;
+        uint32_t consData;
+    } fcTx_t;
+
+    typedef struct {
+        uint32_t initHdr;
+        uint32_t initData;
+        uint32_t hdr;
+        uint32_t data;
+    } fcRx_t;
+
+    void       advance                 (void)
+    {
+        current = (current + 1) % MAX_VIRTUAL_CHANNELS;
+        grants  = 0;
+    };
+
+    // Check credits for VC1 to VC7 using the modulo credit arithmetic of the spec, with VC0
+    // credits checked by the flow control policy
+    bool       hasCredits              (const int vc, const pcieVcTlp_t &tlp)
+    {
+        fcTx_t* s = &tx[vc][tlp.fctype];
+
+        if (vc == 0)
+        {
+            return vc0Fc == NULL || vc0Fc->txHasCredits(tlp.fctype, tlp.hdr, tlp.data);
+        }
+
+        if (!s->init)
+        {
+            return false;
+        }
+
+        bool hdrOk  = s->infHdr  || ((s->limitHdr  - (s->consHdr  + tlp.hdr))  & FC_HDR_CREDIT_MASK)  <= (FC_HDR_CREDIT_MASK  + 1) / 2;
+        bool dataOk = s->infData || ((s->limitData - (s->consData + tlp.data)) & FC_DATA_CREDIT_MASK) <= (FC_DATA_CREDIT_MASK + 1) / 2;
+
+        return hdrOk && dataOk;
+    };
+
+    void       consume                 (const int vc, const pcieVcTlp_t &tlp)
+    {
+        if (vc == 0)
+        {
+            if (vc0Fc != NULL) vc0Fc->txConsume(tlp.fctype, tlp.hdr, tlp.data);
+            return;
+        }
+
+        tx[vc][tlp.fctype].consHdr  += tlp.hdr;
+        tx[vc][tlp.fctype].consData += tlp.data;
+    };
+
+    pcieFcPolicy*           vc0Fc;
+
+    int                     arbitration;
+    int                     current;
+    int                     grants;
+
+    int                     tcMap  [PCIE_NUM_TCS];
+    int                     weight [MAX_VIRTUAL_CHANNELS];
+    bool                    enabled[MAX_VIRTUAL_CHANNELS];
+    bool                    fi2Sent[MAX_VIRTUAL_CHANNELS];
+
+    std::deque<pcieVcTlp_t> queue  [MAX_VIRTUAL_CHANNELS];
+    fcTx_t                  tx     [MAX_VIRTUAL_CHANNELS][FC_NUMTYPES];
+    fcRx_t                  rx     [MAX_VIRTUAL_CHANNELS][FC_NUMTYPES];
+};
+
+#endif
@@ -13,6 +13,7 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   2026.10    Added link utilisation monitor offsets
 //    09/2025   2026.01    Initial Version
 //
 //  This file is part of OSVVM.
@@ -64,6 +65,27 @@
 #define DISABLE_SCRAMBLING     207
 #define DISABLE_8B10B          208
 #define GEN2_CLK               209
+#define LINK_UTIL_SEL          210
+#define LINK_UTIL_COUNT        211
+#define LINK_UTIL_WINDOW       212
+
+// Link utilisation symbol classes
+#define LINK_UTIL_TLP          0
+#define LINK_UTIL_DLLP         1
+#define LINK_UTIL_OS           2
+#define LINK_UTIL_IDLE         3
+#define LINK_UTIL_ELEC_IDLE    4
+#define LINK_UTIL_NUM_TYPES    5
+
+// Link utilisation directions
+#define LINK_UTIL_TX           0
+#define LINK_UTIL_RX           1
+
+// LINK_UTIL_SEL counter select fields
+#define LINK_UTIL_SEL_TYPE_BIT 0
+#define LINK_UTIL_SEL_LANE_BIT 4
+#define LINK_UTIL_SEL_DIR_BIT  8
+#define LINK_UTIL_SEL_WIN_BIT  9
 
 #define PVH_STOP        0xfffffffd
 #define PVH_FINISH      0xfffffffe
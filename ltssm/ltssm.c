@@ -13,6 +13,11 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   2026.10    Added own counter based random stream
+//    10/2026   2026.10    Added ASPM L0s/L1 idle timer entry policy and power
+//                         state residency statistics
+//    10/2026   2026.10    Added 8.0GT/s data rate advertisement and abbreviated
+//                         Recovery.Equalization phases
 //    09/2025   2026.01    Initial Version
 //
 //  This file is part of OSVVM.
@@ -44,6 +49,7 @@
 // -------------------------------------------------------------------------
 
 #include "ltssm.h"
+#include "pcieRng.h"
 
 // -------------------------------------------------------------------------
 // DEFINES
@@ -103,6 +109,33 @@
 
 #define LTSSM_SET_MINIMUM            0
 
+#define LTSSM_EQ_NUM_PHASES          4
+
+#ifdef LTSSM_ABBREVIATED
+#define LTSSM_EQ_PHASE_TX_COUNT      16
+#else
+#define LTSSM_EQ_PHASE_TX_COUNT      1024
+#endif
+
+// 8.0GT/s is advertised with the link remaining 8b/10b encoded, so is only
+// usable between models, and must be explicitly enabled
+#define DEFAULT_GEN3_MODEL_ONLY      0
+
+#define DEFAULT_ASPM_CTL             0
+
+// ASPM L1 handshake: cycles between repeated PM_Active_State_Request_L1 DLLPs,
+// and cycles after the first before the request is abandoned
+#define ASPM_PM_REQ_INTERVAL         32
+#define ASPM_PM_ACK_TIMEOUT          1024
+
+#ifdef LTSSM_ABBREVIATED
+#define DEFAULT_ASPM_L0S_IDLE        64
+#define DEFAULT_ASPM_L1_IDLE         512
+#else
+#define DEFAULT_ASPM_L0S_IDLE        CYCLES_1US
+#define DEFAULT_ASPM_L1_IDLE         (8 * CYCLES_1US)
+#endif
+
 // -------------------------------------------------------------------------
 // STATICS
 // -------------------------------------------------------------------------
@@ -120,12 +153,74 @@ static int  ltssm_enable_tests       [VP_MAX_NODES] = { [0 ... VP_MAX_NODES-1] =
 static int  ltssm_force_tests        [VP_MAX_NODES] = { [0 ... VP_MAX_NODES-1] = DEFAULT_FORCE_TESTS};
 static int  ltssm_poll_tx_count      [VP_MAX_NODES] = { [0 ... VP_MAX_NODES-1] = PCIE_POLLING_ACTIVE_TX_COUNT};
 static int  ltssm_disable_disp_state [VP_MAX_NODES] = { [0 ... VP_MAX_NODES-1] = DEFAULT_DISABLE_DISP_STATE};
+static int  ltssm_gen3_model_only    [VP_MAX_NODES] = { [0 ... VP_MAX_NODES-1] = DEFAULT_GEN3_MODEL_ONLY};
+static int  ltssm_aspm_ctl           [VP_MAX_NODES] = { [0 ... VP_MAX_NODES-1] = DEFAULT_ASPM_CTL};
+static int  ltssm_aspm_l0s_idle      [VP_MAX_NODES] = { [0 ... VP_MAX_NODES-1] = DEFAULT_ASPM_L0S_IDLE};
+static int  ltssm_aspm_l1_idle       [VP_MAX_NODES] = { [0 ... VP_MAX_NODES-1] = DEFAULT_ASPM_L1_IDLE};
 
 static int  ltssm_tx_n_fts           [VP_MAX_NODES] = { [0 ... VP_MAX_NODES-1] = 0};
 
 static bool config_disable           [VP_MAX_NODES] = { [0 ... VP_MAX_NODES-1] = false};
 static bool config_loopback          [VP_MAX_NODES] = { [0 ... VP_MAX_NODES-1] = false};
 static bool polling_compliance       [VP_MAX_NODES] = { [0 ... VP_MAX_NODES-1] = false};
+static bool eq_done                  [VP_MAX_NODES] = { [0 ... VP_MAX_NODES-1] = false};
+
+static int  ltssm_gen                [VP_MAX_NODES] = { [0 ... VP_MAX_NODES-1] = TS_DATA_RATE_GEN1};
+
+// ASPM state, with the cycle the state was entered, the cycle idle time started counting
+// from, and the cycle of the end of the last AspmIdle() call
+static int      aspm_state           [VP_MAX_NODES] = { [0 ... VP_MAX_NODES-1] = ASPM_STATE_L0};
+static uint32_t aspm_since           [VP_MAX_NODES] = { [0 ... VP_MAX_NODES-1] = 0};
+static uint32_t aspm_idle_start      [VP_MAX_NODES] = { [0 ... VP_MAX_NODES-1] = 0};
+static uint32_t aspm_last_idle       [VP_MAX_NODES] = { [0 ... VP_MAX_NODES-1] = 0};
+static uint32_t aspm_stats           [VP_MAX_NODES][ASPM_NUM_STATES][ASPM_NUM_STAT_TYPES];
+
+// PM DLLPs passed on by AspmRxDllp(), with the cycle of the last L1 request
+static bool     aspm_l1_req_rx       [VP_MAX_NODES] = { [0 ... VP_MAX_NODES-1] = false};
+static uint32_t aspm_l1_req_time     [VP_MAX_NODES] = { [0 ... VP_MAX_NODES-1] = 0};
+static bool     aspm_ack_rx          [VP_MAX_NODES] = { [0 ... VP_MAX_NODES-1] = false};
+
+// Random stream for the LTSSM's choices, separate from the model's PcieRand()
+static pcieRng_t ltssm_rng           [VP_MAX_NODES];
+static bool      ltssm_rng_seeded    [VP_MAX_NODES] = { [0 ... VP_MAX_NODES-1] = false};
+
+// -------------------------------------------------------------------------
+// LtssmRand()
+//
+// Next random number of the node's LTSSM stream, which starts from the
+// default seed if not seeded with LtssmSeed().
+//
+// -------------------------------------------------------------------------
+
+static uint32_t LtssmRand (const int node)
+{
+    if (!ltssm_rng_seeded[node])
+    {
+        LtssmSeed(PCIE_RNG_DEFAULT_SEED, node);
+    }
+
+    return PcieRngNext(&ltssm_rng[node]);
+}
+
+// -------------------------------------------------------------------------
+// SendTsRate()
+//
+// Send a training set for the training data rate. The 8.0GT/s rate is
+// only advertised (with SendTsGen()) when training for GEN3, with GEN1
+// and GEN2 training sets sent as before.
+// -------------------------------------------------------------------------
+
+static void SendTsRate (const int identifier, const int lane_num, const int link_num, const int n_fts, const int control, const int gen, const int node)
+{
+    if (gen & TS_DATA_RATE_8GT_BIT)
+    {
+        SendTsGen(identifier, lane_num, link_num, n_fts, control, gen, node);
+    }
+    else
+    {
+        SendTs(identifier, lane_num, link_num, n_fts, control, gen & 0x4, node);
+    }
+}
 
 // -------------------------------------------------------------------------
 // Detect()
@@ -177,11 +272,11 @@ static int Polling(int *active_lanes, const int gen, const int node)
     ResetEventCount(TS2_ID, node);
 
     // --- force compliance ---
-    if (polling_compliance[node] == false && ((ltssm_force_tests[node] & ENABLE_COMPLIANCE) || ((ltssm_enable_tests[node] & ENABLE_COMPLIANCE) && ((PcieRand(node) % 3) == 0))))
+    if (polling_compliance[node] == false && ((ltssm_force_tests[node] & ENABLE_COMPLIANCE) || ((ltssm_enable_tests[node] & ENABLE_COMPLIANCE) && ((LtssmRand(node) % 3) == 0))))
     {
         if (!ltssm_disable_disp_state[node]) VPrint("---> Polling Compliance (node %d)\n", node);
         polling_compliance[node] = true;
-        VWrite(LINK_STATE, (1 << (PcieRand(node) % ltssm_max_link_width[node])) | ~ltssm_max_link_mask[node], 1, node);
+        VWrite(LINK_STATE, (1 << (LtssmRand(node) % ltssm_max_link_width[node])) | ~ltssm_max_link_mask[node], 1, node);
 
         // This is a very nasty hack, of which I am appropriately ashamed.
         // It is an open loop delay long enough for endpoint to timeout in
@@ -196,7 +291,7 @@ static int Polling(int *active_lanes, const int gen, const int node)
     VWrite(LINK_STATE, (~ltssm_max_link_mask[node]) & 0xffff, 1, node);
     do
     {
-        SendTs(TS1_ID, PAD, PAD, ltssm_n_fts[node], ltssm_ts_ctl[node], gen & 0x4, node);
+        SendTsRate(TS1_ID, PAD, PAD, ltssm_n_fts[node], ltssm_ts_ctl[node], gen, node);
         ReadEventCount(TS1_ID, ts1_count, node);
         ReadEventCount(TS2_ID, ts2_count, node);
         ts_status = GetTS(0, node);
@@ -217,7 +312,7 @@ static int Polling(int *active_lanes, const int gen, const int node)
     ResetEventCount(TS2_ID, node);
     do
     {
-        SendTs(TS2_ID, PAD, PAD, ltssm_n_fts[node], ltssm_ts_ctl[node], gen & 0x4, node);
+        SendTsRate(TS2_ID, PAD, PAD, ltssm_n_fts[node], ltssm_ts_ctl[node], gen, node);
         ReadEventCount(TS2_ID, ts2_count, node);
         ts_status = GetTS(0, node);
         if (ts2_count[0] || i)
@@ -262,7 +357,7 @@ static int Configuration(const int active_lanes, const int gen, const int target
     if (!ltssm_disable_disp_state[node]) VPrint("---> Configuration Start (node %d)\n", node);
 
     // If not done so before, randomly choose to go to disabled state
-    if (config_disable[node] == false && ((ltssm_force_tests[node] & ENABLE_DISABLE) || ((ltssm_enable_tests[node] & ENABLE_DISABLE) && ((PcieRand(node) % 3) == 0))))
+    if (config_disable[node] == false && ((ltssm_force_tests[node] & ENABLE_DISABLE) || ((ltssm_enable_tests[node] & ENABLE_DISABLE) && ((LtssmRand(node) % 3) == 0))))
     {
         config_disable[node] = true;
         if (!ltssm_disable_disp_state[node]) VPrint("---> Going to Disabled from Configuration Start (node %d)\n", node);
@@ -270,7 +365,7 @@ static int Configuration(const int active_lanes, const int gen, const int target
     }
 
     // If not done so before, randomly choose to go to loopback state
-    if (config_loopback[node] == false && ((ltssm_force_tests[node] & ENABLE_LOOPBACK) || ((ltssm_enable_tests[node] & ENABLE_LOOPBACK) && ((PcieRand(node) % 3) == 0))))
+    if (config_loopback[node] == false && ((ltssm_force_tests[node] & ENABLE_LOOPBACK) || ((ltssm_enable_tests[node] & ENABLE_LOOPBACK) && ((LtssmRand(node) % 3) == 0))))
     {
         config_loopback[node] = true;
         if (!ltssm_disable_disp_state[node]) VPrint("---> Going to Loopback from Configuration Start (node %d)\n", node);
@@ -280,7 +375,7 @@ static int Configuration(const int active_lanes, const int gen, const int target
     ResetEventCount(TS1_ID, node);
     do
     {
-        SendTs(TS1_ID, PAD, ltssm_linknum[node], ltssm_n_fts[node], ltssm_ts_ctl[node], gen & 0x4, node);
+        SendTsRate(TS1_ID, PAD, ltssm_linknum[node], ltssm_n_fts[node], ltssm_ts_ctl[node], gen, node);
         ReadEventCount(TS1_ID, ts1_count, node);
         ts_status = GetTS(0, node);
 
@@ -300,7 +395,7 @@ static int Configuration(const int active_lanes, const int gen, const int target
     ResetEventCount(TS1_ID, node);
     do
     {
-        SendTs(TS1_ID, ENABLE_LANENUMS, ltssm_linknum[node], ltssm_n_fts[node], ltssm_ts_ctl[node], gen & 0x4, node);
+        SendTsRate(TS1_ID, ENABLE_LANENUMS, ltssm_linknum[node], ltssm_n_fts[node], ltssm_ts_ctl[node], gen, node);
         for (i=0; i < lnkwidth; i++)
         {
             ts_status = GetTS(i, node);
@@ -318,7 +413,7 @@ static int Configuration(const int active_lanes, const int gen, const int target
     ResetEventCount(TS1_ID, node);
     do
     {
-        SendTs(TS1_ID, ENABLE_LANENUMS, ltssm_linknum[node], ltssm_n_fts[node], ltssm_ts_ctl[node], gen & 0x4, node);
+        SendTsRate(TS1_ID, ENABLE_LANENUMS, ltssm_linknum[node], ltssm_n_fts[node], ltssm_ts_ctl[node], gen, node);
         for (i=0; i < lnkwidth; i++)
         {
             ts_status = GetTS(i, node);
@@ -337,7 +432,7 @@ static int Configuration(const int active_lanes, const int gen, const int target
     int ts2_sendcount = 0;
     do
     {
-        SendTs(TS2_ID, ENABLE_LANENUMS, ltssm_linknum[node], ltssm_n_fts[node], ltssm_ts_ctl[node], gen & 0x4, node);
+        SendTsRate(TS2_ID, ENABLE_LANENUMS, ltssm_linknum[node], ltssm_n_fts[node], ltssm_ts_ctl[node], gen, node);
 
         // Start counting sent TS2s once a TS2 has been received
         if (ts2_count[0])
@@ -380,14 +475,11 @@ static int Configuration(const int active_lanes, const int gen, const int target
 }
 
 // -------------------------------------------------------------------------
-// TxL0s()
+// TxL0sEntry()/TxL0sExit()
 // -------------------------------------------------------------------------
 
-static int TxL0s (const int target_state, const int active_lanes, const int ticks, const int node)
+static void TxL0sEntry (const int node)
 {
-    int i;
-
-    // ---------------
     if (!ltssm_disable_disp_state[node])  VPrint("---> TxL0s Entry (node %d)\n", node);
 
     // Inform model that the transmitter is down (and thus queue their data)
@@ -396,12 +488,12 @@ static int TxL0s (const int target_state, const int active_lanes, const int tick
     SendOs(IDL, node);
     // Shut down the lanes
     VWrite(LINK_STATE, 0xffff, 1, node);
+}
 
-    // ---------------
-    if (!ltssm_disable_disp_state[node]) VPrint("---> TxL0s Idle: sleeping for %d ticks (node %d)\n", ticks, node);
-    SendIdle(ticks, node);
+static void TxL0sExit (const int active_lanes, const int node)
+{
+    int i;
 
-    // ---------------
     if (!ltssm_disable_disp_state[node]) VPrint("---> TxL0s FTS (node %d)\n", node);
     VWrite(LINK_STATE, ~(active_lanes & ltssm_max_link_mask[node]) & 0xffff, 1, node);
     for (i = 0; i < ltssm_tx_n_fts[node]; i++)
@@ -413,10 +505,57 @@ static int TxL0s (const int target_state, const int active_lanes, const int tick
 
     // The transmitter is available once again
     SetTxEnabled(node);
+}
+
+// -------------------------------------------------------------------------
+// TxL0s()
+// -------------------------------------------------------------------------
+
+static int TxL0s (const int target_state, const int active_lanes, const int ticks, const int node)
+{
+    TxL0sEntry(node);
+
+    // ---------------
+    if (!ltssm_disable_disp_state[node]) VPrint("---> TxL0s Idle: sleeping for %d ticks (node %d)\n", ticks, node);
+    SendIdle(ticks, node);
+
+    TxL0sExit(active_lanes, node);
 
     return LTSSM_L0;
 }
 
+// -------------------------------------------------------------------------
+// Equalization()
+//
+// Abbreviated Recovery.Equalization for 8.0GT/s. The model's PHY has only
+// 8b/10b encoding, so the phases are sequenced with TS1 ordered sets at
+// the current rate, with each phase complete when the link partner's TS1s
+// have been seen and the phase's TS1s sent.
+//
+// -------------------------------------------------------------------------
+
+static void Equalization (const int gen, const int node)
+{
+    uint32_t ts1_count[MAX_LINK_WIDTH];
+    int phase, i;
+
+    for (phase = 0; phase < LTSSM_EQ_NUM_PHASES; phase++)
+    {
+        if (!ltssm_disable_disp_state[node]) VPrint("---> Recovery Equalization Phase %d (node %d)\n", phase, node);
+
+        ResetEventCount(TS1_ID, node);
+        i = 0;
+        do
+        {
+            SendTsRate(TS1_ID, ENABLE_LANENUMS, ltssm_linknum[node], ltssm_n_fts[node], ltssm_ts_ctl[node], gen, node);
+            ReadEventCount(TS1_ID, ts1_count, node);
+            i++;
+        } while ((ts1_count[0] < 2) || (i < LTSSM_EQ_PHASE_TX_COUNT));
+    }
+
+    eq_done[node] = true;
+}
+
 // -------------------------------------------------------------------------
 // Recovery()
 // -------------------------------------------------------------------------
@@ -434,7 +573,7 @@ static int Recovery (const int gen, const int target_state, const int node)
     ResetEventCount(TS2_ID, node);
 
     // One in 16 chance of altering the configuration
-    if (1 || (PcieRand(node) & 0xf) == 0)
+    if (1 || (LtssmRand(node) & 0xf) == 0)
     {
         change_config = true;
     }
@@ -443,14 +582,21 @@ static int Recovery (const int gen, const int target_state, const int node)
     // Exit when seen at least 8
     do
     {
-        SendTs(TS1_ID, ENABLE_LANENUMS, ltssm_linknum[node], ltssm_n_fts[node], ltssm_ts_ctl[node], gen & 0x4, node);
+        SendTsRate(TS1_ID, ENABLE_LANENUMS, ltssm_linknum[node], ltssm_n_fts[node], ltssm_ts_ctl[node], gen, node);
         ReadEventCount(TS1_ID, ts1_count, node);
         ReadEventCount(TS2_ID, ts2_count, node);
     } while((ts1_count[0] < 8) && (ts2_count[0] < 8));
 
+    // Equalize once when both sides support 8.0GT/s
+    ts_status = GetTS(0, node);
+    if ((gen & ts_status.datarate & TS_DATA_RATE_8GT_BIT) && !eq_done[node])
+    {
+        Equalization(gen, node);
+    }
+
     if (change_config)
     {
-        ltssm_n_fts[node] =  PcieRand(node)%252 + 4; // at least 4
+        ltssm_n_fts[node] =  LtssmRand(node)%252 + 4; // at least 4
     }
 
     // --- RcvrCfg ---
@@ -465,7 +611,7 @@ static int Recovery (const int gen, const int target_state, const int node)
     i = 0;
     do
     {
-        SendTs(TS2_ID, ENABLE_LANENUMS, ltssm_linknum[node], ltssm_n_fts[node], ltssm_ts_ctl[node], gen & 0x4, node);
+        SendTsRate(TS2_ID, ENABLE_LANENUMS, ltssm_linknum[node], ltssm_n_fts[node], ltssm_ts_ctl[node], gen, node);
         ReadEventCount(TS2_ID, ts2_count, node);
         ReadEventCount(IDL, idl_count, node);
         if (idl_count[0] || (ts2_count[0] == 0))
@@ -526,7 +672,7 @@ static int Disabled (const int gen, const int node)
     // Transmit 16 TS1 OS's with disabled set
     for (i=0; i < 16; i++)
     {
-       SendTs(TS1_ID, ENABLE_LANENUMS, ltssm_linknum[node], ltssm_n_fts[node], TS_CNTL_DISABLE_LINK, gen & 0x4, node);
+       SendTsRate(TS1_ID, ENABLE_LANENUMS, ltssm_linknum[node], ltssm_n_fts[node], TS_CNTL_DISABLE_LINK, gen, node);
     }
 
     // Tx EIOS
@@ -544,7 +690,7 @@ static int Disabled (const int gen, const int node)
     } while (!idl_count[0]);
 
     //Send a random amount of idles (i.e. wait for a set time---this link is electrically idle)
-    //rand_idle = (PcieRand(node) % 1000) + 25;
+    //rand_idle = (LtssmRand(node) % 1000) + 25;
     rand_idle = 100;
 
     if (!ltssm_disable_disp_state[node]) VPrint("---> Waiting for %d ticks (node %d)\n", rand_idle, node);
@@ -574,7 +720,7 @@ static int Loopback (const int gen, const int node)
     // Transmit TS1s OS's with loopback set until a TS1 with loopback set is received
     do
     {
-        SendTs(TS1_ID, ENABLE_LANENUMS, ltssm_linknum[node], ltssm_n_fts[node], TS_CTL_LOOPBACK, gen & 0x4, node);
+        SendTsRate(TS1_ID, ENABLE_LANENUMS, ltssm_linknum[node], ltssm_n_fts[node], TS_CTL_LOOPBACK, gen, node);
         ReadEventCount(TS1_ID, count, node);
         ts_status = GetTS(0, node);
         if (!ltssm_disable_disp_state[node]) VPrint("count[0] = %x ts_status.control = %x\n", count[0], ts_status.control);
@@ -586,7 +732,7 @@ static int Loopback (const int gen, const int node)
     // Stay in Loopback.Active for a while
     for (i = 0; i < 64; i++)
     {
-        SendTs(TS1_ID, ENABLE_LANENUMS, ltssm_linknum[node], ltssm_n_fts[node], TS_CTL_LOOPBACK, gen & 0x4, node);
+        SendTsRate(TS1_ID, ENABLE_LANENUMS, ltssm_linknum[node], ltssm_n_fts[node], TS_CTL_LOOPBACK, gen, node);
     }
 
     // ---- Loopback.Exit ----
@@ -609,7 +755,7 @@ static int Loopback (const int gen, const int node)
     } while (!count[0]);
 
     //Send a random amount of idles (i.e. wait for a set time---this link is electrically idle)
-    //rand_idle = (PcieRand(node) % 1000) + 25;
+    //rand_idle = (LtssmRand(node) % 1000) + 25;
     rand_idle = 1000;
 
     if (!ltssm_disable_disp_state[node]) VPrint("---> Waiting for %d ticks (node %d)\n", rand_idle, node);
@@ -636,7 +782,7 @@ static int HotReset (const int HotResetTO, const int gen, const int node)
 
     for (i=0; i < loops; i++)
     {
-        SendTs(TS1_ID, 0, ltssm_linknum[node], ltssm_n_fts[node], TS_CNTL_HOT_RESET, gen & 0x4, node);
+        SendTsRate(TS1_ID, 0, ltssm_linknum[node], ltssm_n_fts[node], TS_CNTL_HOT_RESET, gen, node);
     }
 
     return LTSSM_DETECT;
@@ -686,6 +832,139 @@ static int L2 (const int time_in_l2_param, const int node)
     return LTSSM_DETECT;
 }
 
+// -------------------------------------------------------------------------
+// AspmL1Request()
+//
+// Requester side of the ASPM L1 handshake, repeating
+// PM_Active_State_Request_L1 until the link partner replies with
+// PM_Request_Ack, returning true, or until the request times out,
+// returning false. A request from the partner crossing with this one is
+// acknowledged, and accepted as the reply. Received DLLPs must be passed
+// on with AspmRxDllp(), as they arrive, for the replies to be seen.
+//
+// -------------------------------------------------------------------------
+
+static bool AspmL1Request (const int node)
+{
+    uint32_t start = GetCycleCount(node);
+
+    if (!ltssm_disable_disp_state[node]) VPrint("---> ASPM L1 Request (node %d)\n", node);
+
+    aspm_ack_rx[node] = false;
+
+    // Only a request still awaiting a reply crosses with this one
+    if (start - aspm_l1_req_time[node] >= ASPM_PM_ACK_TIMEOUT)
+    {
+        aspm_l1_req_rx[node] = false;
+    }
+
+    while (!aspm_ack_rx[node] && !aspm_l1_req_rx[node])
+    {
+        if (GetCycleCount(node) - start >= ASPM_PM_ACK_TIMEOUT)
+        {
+            if (!ltssm_disable_disp_state[node]) VPrint("---> ASPM L1 Request: no PM_Request_Ack (node %d)\n", node);
+            return false;
+        }
+
+        SendPM(DL_PM_REQ_L1, false, node);
+        SendIdle(ASPM_PM_REQ_INTERVAL, node);
+    }
+
+    if (aspm_l1_req_rx[node])
+    {
+        SendPM(DL_PM_REQ_ACK, false, node);
+    }
+
+    aspm_l1_req_rx[node] = false;
+    aspm_ack_rx[node]    = false;
+
+    return true;
+}
+
+// -------------------------------------------------------------------------
+// AspmL1Entry()/AspmL1Exit()
+//
+// Abbreviated ASPM L1 entry once the handshake is complete, with the
+// transmitter disabled and the lanes put in electrical idle. Exit is
+// through Recovery.
+//
+// -------------------------------------------------------------------------
+
+static void AspmL1Entry (const int node)
+{
+    if (!ltssm_disable_disp_state[node]) VPrint("---> ASPM L1 Entry (node %d)\n", node);
+
+    SetTxDisabled(node);
+
+    SendOs(IDL, node);
+
+    // Shut down the lanes
+    VWrite(LINK_STATE, 0xffff, 1, node);
+}
+
+static void AspmL1Exit (const int node)
+{
+    if (!ltssm_disable_disp_state[node]) VPrint("---> ASPM L1 Exit (node %d)\n", node);
+
+    VWrite(LINK_STATE, ~ltssm_max_link_mask[node] & 0xffff, 1, node);
+
+    Recovery(ltssm_gen[node], LTSSM_L0, node);
+
+    SetTxEnabled(node);
+}
+
+// -------------------------------------------------------------------------
+// AspmSetState()
+//
+// Change ASPM state, accumulating the residency of the state being left.
+//
+// -------------------------------------------------------------------------
+
+static void AspmSetState (const int state, const int node)
+{
+    uint32_t now = GetCycleCount(node);
+
+    aspm_stats[node][aspm_state[node]][ASPM_STAT_RESIDENCY] += now - aspm_since[node];
+
+    aspm_state[node] = state;
+    aspm_since[node] = now;
+}
+
+// -------------------------------------------------------------------------
+// AspmLeave()
+//
+// Return to L0 from a low power state, with the cycles taken to exit
+// accumulated as the state's exit penalty, rather than as residency.
+//
+// -------------------------------------------------------------------------
+
+static void AspmLeave (const int node)
+{
+    int      state = aspm_state[node];
+    uint32_t start = GetCycleCount(node);
+
+    if (state == ASPM_STATE_L0)
+    {
+        return;
+    }
+
+    AspmSetState(ASPM_STATE_L0, node);
+
+    if (state == ASPM_STATE_L0S)
+    {
+        TxL0sExit(ltssm_max_link_mask[node], node);
+    }
+    else
+    {
+        AspmL1Exit(node);
+    }
+
+    aspm_since[node] = GetCycleCount(node);
+
+    aspm_stats[node][state][ASPM_STAT_EXITS]++;
+    aspm_stats[node][state][ASPM_STAT_EXIT_CYCLES] += aspm_since[node] - start;
+}
+
 // -------------------------------------------------------------------------
 // LinkState()
 //
@@ -754,11 +1033,38 @@ static int LinkState (const int ltssm_state, const int target_state, const int l
 void InitLinkGen(const int link_width, const int gen, const int node)
 {
     int ltssm_state = LTSSM_DETECT;
+    TS_t ts_status;
+
+    // The link stays 8b/10b encoded when 8.0GT/s is negotiated, which a real 8.0GT/s
+    // partner will not accept, so GEN3 is only allowed once enabled for model to model links
+    if ((gen & TS_DATA_RATE_8GT_BIT) && !ltssm_gen3_model_only[node])
+    {
+        VPrint ("InitLinkGen(): ***Error: 8.0GT/s is only supported between models (enable with CONFIG_LTSSM_GEN3_MODEL_ONLY) at node %d\n", node);
+        VWrite(PVH_FATAL, 0, 0, node);
+        return;
+    }
+
+    eq_done[node]   = false;
+    ltssm_gen[node] = gen;
 
     do
     {
         ltssm_state = LinkState(ltssm_state, LTSSM_L0, link_width, gen, node);
+
+        // On first reaching L0 with 8.0GT/s supported by both sides, go through
+        // recovery to equalize
+        if (ltssm_state == LTSSM_L0 && !eq_done[node])
+        {
+            ts_status = GetTS(0, node);
+            if (gen & ts_status.datarate & TS_DATA_RATE_8GT_BIT)
+            {
+                ltssm_state = LTSSM_RECOVERY;
+            }
+        }
     } while (ltssm_state != LTSSM_L0);
+
+    aspm_state[node] = ASPM_STATE_L0;
+    ResetAspmStats(node);
 }
 
 void InitLink(const int link_width, const int node)
@@ -784,6 +1090,10 @@ void ConfigLinkInit (const ConfigLinkInit_t cfg, const int node)
     ltssm_force_tests[node]        = (cfg.ltssm_force_tests          == LINK_INIT_NO_CHANGE) ? ltssm_force_tests[node]        : cfg.ltssm_force_tests;
     ltssm_poll_tx_count[node]      = (cfg.ltssm_poll_active_tx_count == LINK_INIT_NO_CHANGE) ? ltssm_poll_tx_count[node]      : cfg.ltssm_poll_active_tx_count;
     ltssm_disable_disp_state[node] = (cfg.ltssm_disable_disp_state   == LINK_INIT_NO_CHANGE) ? ltssm_disable_disp_state[node] : cfg.ltssm_disable_disp_state;
+    ltssm_gen3_model_only[node]    = (cfg.ltssm_gen3_model_only      == LINK_INIT_NO_CHANGE) ? ltssm_gen3_model_only[node]    : cfg.ltssm_gen3_model_only;
+    ltssm_aspm_ctl[node]           = (cfg.ltssm_aspm_ctl             == LINK_INIT_NO_CHANGE) ? ltssm_aspm_ctl[node]           : cfg.ltssm_aspm_ctl        & ASPM_CTL_MASK;
+    ltssm_aspm_l0s_idle[node]      = (cfg.ltssm_aspm_l0s_idle        == LINK_INIT_NO_CHANGE) ? ltssm_aspm_l0s_idle[node]      : cfg.ltssm_aspm_l0s_idle;
+    ltssm_aspm_l1_idle[node]       = (cfg.ltssm_aspm_l1_idle         == LINK_INIT_NO_CHANGE) ? ltssm_aspm_l1_idle[node]       : cfg.ltssm_aspm_l1_idle;
 }
 
 // -------------------------------------------------------------------------
@@ -842,6 +1152,26 @@ void ConfigurePcieLtssm(const config_t type, const int value, const int node)
         ltssm_cfg_updated = true;
         break;
 
+    case CONFIG_LTSSM_GEN3_MODEL_ONLY:
+        ltssm_cfg.ltssm_gen3_model_only = value;
+        ltssm_cfg_updated = true;
+        break;
+
+    case CONFIG_LTSSM_ASPM_CTL:
+        ltssm_cfg.ltssm_aspm_ctl = value;
+        ltssm_cfg_updated = true;
+        break;
+
+    case CONFIG_LTSSM_ASPM_L0S_IDLE:
+        ltssm_cfg.ltssm_aspm_l0s_idle = value;
+        ltssm_cfg_updated = true;
+        break;
+
+    case CONFIG_LTSSM_ASPM_L1_IDLE:
+        ltssm_cfg.ltssm_aspm_l1_idle = value;
+        ltssm_cfg_updated = true;
+        break;
+
     default:
         VPrint("ConfigurePcieLtssm: ***Error --- bad config type at node %d\n", node);
         VWrite(PVH_FATAL, 0, 0, node);
@@ -853,3 +1183,218 @@ void ConfigurePcieLtssm(const config_t type, const int value, const int node)
         ConfigLinkInit(ltssm_cfg, node);
     }
 }
+
+// -------------------------------------------------------------------------
+// LtssmSeed()
+//
+// Restart the node's LTSSM random stream from a seed.
+//
+// -------------------------------------------------------------------------
+
+void LtssmSeed (const uint64_t seed, const int node)
+{
+    PcieRngInit(&ltssm_rng[node], seed, PCIE_RNG_STREAM_ID(PCIE_RNG_STREAM_LTSSM, node));
+    ltssm_rng_seeded[node] = true;
+}
+
+// -------------------------------------------------------------------------
+// AspmIdle()
+//
+// Idle the link for a number of ticks under the ASPM policy. Idle time
+// accumulates over consecutive calls with no other activity in between,
+// and L0s is entered once it reaches the L0s idle time and L1 once it
+// reaches the L1 idle time, as enabled by the ASPM control. L1 is only
+// entered once the link partner has replied to PM_Active_State_Request_L1
+// with PM_Request_Ack, and the partner's own requests are acknowledged
+// whilst L1 is enabled. The partner's requests and replies are only seen
+// when received DLLPs are passed on with AspmRxDllp(). A refused request
+// is not Nak'd with a PM_Active_State_Nak message, so times out. The
+// link is left in any low power state entered, to be returned to L0 with
+// AspmExit() before sending.
+//
+// The model's replay buffer and DLLP queue can not be inspected from
+// here, so it is a precondition that the caller has no TLPs awaiting
+// acknowledgement and no DLLPs (Acks, UpdateFCs) still to send, as for
+// entry in the specification. Idle time counts from the call, so
+// calling after waiting for outstanding Acks is sufficient.
+//
+// -------------------------------------------------------------------------
+
+void AspmIdle (const int ticks, const int node)
+{
+    uint32_t now = GetCycleCount(node);
+    uint32_t end = now + ticks;
+
+    if (now != aspm_last_idle[node])
+    {
+        aspm_idle_start[node] = now;
+    }
+
+    while ((int32_t)(end - now) > 0)
+    {
+        uint32_t idle    = now - aspm_idle_start[node];
+        int      run     = (int)(end - now);
+        bool     l0s_en  = (ltssm_aspm_ctl[node] & ASPM_CTL_L0S) && aspm_state[node] == ASPM_STATE_L0;
+        bool     l1_en   = (ltssm_aspm_ctl[node] & ASPM_CTL_L1)  && aspm_state[node] != ASPM_STATE_L1;
+
+        // A recent L1 request from the link partner is acknowledged, entering L1 from L0
+        if (l1_en && aspm_l1_req_rx[node] && now - aspm_l1_req_time[node] < ASPM_PM_ACK_TIMEOUT)
+        {
+            AspmLeave(node);
+
+            SendPM(DL_PM_REQ_ACK, false, node);
+            aspm_l1_req_rx[node] = false;
+
+            AspmSetState(ASPM_STATE_L1, node);
+            aspm_stats[node][ASPM_STATE_L1][ASPM_STAT_ENTRIES]++;
+            AspmL1Entry(node);
+        }
+        else if (l1_en && idle >= (uint32_t)ltssm_aspm_l1_idle[node])
+        {
+            AspmLeave(node);
+
+            if (AspmL1Request(node))
+            {
+                AspmSetState(ASPM_STATE_L1, node);
+                aspm_stats[node][ASPM_STATE_L1][ASPM_STAT_ENTRIES]++;
+                AspmL1Entry(node);
+            }
+            else
+            {
+                // Refused, so wait for the L1 idle time again
+                aspm_idle_start[node] = GetCycleCount(node);
+            }
+        }
+        else if (l0s_en && idle >= (uint32_t)ltssm_aspm_l0s_idle[node])
+        {
+            AspmSetState(ASPM_STATE_L0S, node);
+            aspm_stats[node][ASPM_STATE_L0S][ASPM_STAT_ENTRIES]++;
+            TxL0sEntry(node);
+        }
+        else
+        {
+            // Idle up to the next entry point
+            if (l0s_en && (uint32_t)ltssm_aspm_l0s_idle[node] - idle < (uint32_t)run)
+            {
+                run = ltssm_aspm_l0s_idle[node] - idle;
+            }
+
+            if (l1_en && (uint32_t)ltssm_aspm_l1_idle[node] - idle < (uint32_t)run)
+            {
+                run = ltssm_aspm_l1_idle[node] - idle;
+            }
+
+            // Idle in steps while L1 is enabled, to answer the link partner's requests
+            if (l1_en && run > ASPM_PM_REQ_INTERVAL)
+            {
+                run = ASPM_PM_REQ_INTERVAL;
+            }
+
+            SendIdle(run, node);
+        }
+
+        now = GetCycleCount(node);
+    }
+
+    aspm_last_idle[node] = now;
+}
+
+// -------------------------------------------------------------------------
+// AspmRxDllp()
+//
+// Note the PM DLLPs of the ASPM L1 handshake in a DLLP received from the
+// link partner. To be called from the receive callback with each DLLP's
+// packet data.
+//
+// -------------------------------------------------------------------------
+
+void AspmRxDllp (const PktData_t* dllp, const int node)
+{
+    switch (dllp[DLLP_TYPE_OFFSET] & BYTE_MASK)
+    {
+    case DL_PM_REQ_L1:
+        aspm_l1_req_rx[node]   = true;
+        aspm_l1_req_time[node] = GetCycleCount(node);
+        break;
+    case DL_PM_REQ_ACK:
+        aspm_ack_rx[node]      = true;
+        break;
+    default:
+        break;
+    }
+}
+
+// -------------------------------------------------------------------------
+// AspmExit()
+//
+// Return the link to L0 from any ASPM low power state, and restart the
+// idle time.
+//
+// -------------------------------------------------------------------------
+
+void AspmExit (const int node)
+{
+    AspmLeave(node);
+
+    aspm_last_idle[node] = GetCycleCount(node) - 1;
+}
+
+// -------------------------------------------------------------------------
+// GetAspmState()
+//
+// Return the current ASPM state (ASPM_STATE_L0, ASPM_STATE_L0S or
+// ASPM_STATE_L1).
+//
+// -------------------------------------------------------------------------
+
+int GetAspmState (const int node)
+{
+    return aspm_state[node];
+}
+
+// -------------------------------------------------------------------------
+// ResetAspmStats()
+//
+// Clear the ASPM statistics, with residency counted from now in the
+// current state.
+//
+// -------------------------------------------------------------------------
+
+void ResetAspmStats (const int node)
+{
+    int state, type;
+
+    for (state = 0; state < ASPM_NUM_STATES; state++)
+    {
+        for (type = 0; type < ASPM_NUM_STAT_TYPES; type++)
+        {
+            aspm_stats[node][state][type] = 0;
+        }
+    }
+
+    aspm_since[node] = GetCycleCount(node);
+}
+
+// -------------------------------------------------------------------------
+// ReadAspmStat()
+//
+// Return an ASPM statistic for a power state (ASPM_STATE_L0,
+// ASPM_STATE_L0S or ASPM_STATE_L1), being the residency in cycles
+// (ASPM_STAT_RESIDENCY), the number of entries (ASPM_STAT_ENTRIES) or
+// exits (ASPM_STAT_EXITS), or the total cycles taken to exit back to L0
+// (ASPM_STAT_EXIT_CYCLES) with fast training sequences or retraining.
+//
+// -------------------------------------------------------------------------
+
+uint32_t ReadAspmStat (const int state, const int type, const int node)
+{
+    uint32_t stat = aspm_stats[node][state][type];
+
+    // Include the residency of the current state so far
+    if (type == ASPM_STAT_RESIDENCY && state == aspm_state[node])
+    {
+        stat += GetCycleCount(node) - aspm_since[node];
+    }
+
+    return stat;
+}
@@ -13,6 +13,8 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   2026.10    Added LTSSM random stream seeding
+//    10/2026   2026.10    Added ASPM policy and power state residency functions
 //    09/2025   2026.01    Initial Version
 //
 //  This file is part of OSVVM.
@@ -60,6 +62,23 @@ extern "C" {
 
 #define LINK_INIT_NO_CHANGE  (-1)
 
+// ASPM control (as for the link control register ASPM control field)
+#define ASPM_CTL_L0S          0x1
+#define ASPM_CTL_L1           0x2
+#define ASPM_CTL_MASK         0x3
+
+// ASPM power states and statistic types
+#define ASPM_STATE_L0         0
+#define ASPM_STATE_L0S        1
+#define ASPM_STATE_L1         2
+#define ASPM_NUM_STATES       3
+
+#define ASPM_STAT_RESIDENCY   0
+#define ASPM_STAT_ENTRIES     1
+#define ASPM_STAT_EXITS       2
+#define ASPM_STAT_EXIT_CYCLES 3
+#define ASPM_NUM_STAT_TYPES   4
+
 typedef struct
 {
     int ltssm_linknum;
@@ -70,6 +89,10 @@ typedef struct
     int ltssm_force_tests;
     int ltssm_poll_active_tx_count;
     int ltssm_disable_disp_state;
+    int ltssm_gen3_model_only;
+    int ltssm_aspm_ctl;
+    int ltssm_aspm_l0s_idle;
+    int ltssm_aspm_l1_idle;
 
 } ConfigLinkInit_t;
 
@@ -82,6 +105,10 @@ typedef struct
   (_cfg).ltssm_force_tests          = LINK_INIT_NO_CHANGE; \
   (_cfg).ltssm_poll_active_tx_count = LINK_INIT_NO_CHANGE; \
   (_cfg).ltssm_disable_disp_state    = LINK_INIT_NO_CHANGE; \
+  (_cfg).ltssm_gen3_model_only       = LINK_INIT_NO_CHANGE; \
+  (_cfg).ltssm_aspm_ctl              = LINK_INIT_NO_CHANGE; \
+  (_cfg).ltssm_aspm_l0s_idle         = LINK_INIT_NO_CHANGE; \
+  (_cfg).ltssm_aspm_l1_idle          = LINK_INIT_NO_CHANGE; \
 }
 
 // Link initialisation
@@ -89,5 +116,14 @@ EXTERN void InitLink             (const int linkwidth,         const int node);
 EXTERN void InitLinkGen          (const int linkwidth,         const int gen,   const int node);
 EXTERN void ConfigLinkInit       (const ConfigLinkInit_t cfg,  const int node);
 EXTERN void ConfigurePcieLtssm   (const config_t         type, const int value, const int node);
+EXTERN void LtssmSeed            (const uint64_t         seed,                  const int node);
+
+// ASPM policy and power state statistics
+EXTERN void     AspmIdle         (const int ticks,             const int node);
+EXTERN void     AspmExit         (const int node);
+EXTERN int      GetAspmState     (const int node);
+EXTERN void     ResetAspmStats   (const int node);
+EXTERN uint32_t ReadAspmStat     (const int state,             const int type,  const int node);
+EXTERN void     AspmRxDllp       (const PktData_t* dllp,       const int node);
 
 #endif
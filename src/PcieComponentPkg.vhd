@@ -14,6 +14,8 @@
 --
 --  Revision History:
 --    Date      Version    Description
+--    10/2026   2026.10       Added TLP stream model and adapter components, and
+--                            link utilisation file and serial symbol mode generics
 --    10/2025   2026.01       Initial revision
 --
 --
@@ -73,7 +75,9 @@ package PcieComponentPkg is
       PIPE               : boolean := false ; -- true if output to be PIPE compatible (no scrambling or 8b10b encoding; lane width is 9 bits instead of 10)
       DISABLE_SCRAMBLING : boolean := false ; -- true if output to have no scrambling
       ENABLE_INIT_PHY    : boolean := true  ; -- true if PHY layer link training is to be enabled
-      ENABLE_AUTO        : boolean := false   -- true if PCIe automatic features are to be enabled
+      ENABLE_AUTO        : boolean := false ; -- true if PCIe automatic features are to be enabled
+      LINK_UTIL_ENABLE   : boolean := false ; -- true to enable the link utilisation monitor (implied by LINK_UTIL_FILE)
+      LINK_UTIL_FILE     : string  := ""      -- if not empty, file for link utilisation time series, one line per window
     ) ;
     port (
       -- Globals
@@ -102,7 +106,9 @@ package PcieComponentPkg is
       REQ_ID                : integer := 0 ;
       EN_TLP_REQ_DIGEST     : boolean := false ;
       ENABLE_INIT_PHY       : boolean := true  ;
-      ENABLE_AUTO           : boolean := false
+      ENABLE_AUTO           : boolean := false ;
+      GEN2_CLK              : boolean := false ;
+      SYMBOL_MODE           : boolean := false
     );
     port (
       Clk                   : in  std_logic;
@@ -120,10 +126,12 @@ package PcieComponentPkg is
   component PcieModelSerialiser is
   ------------------------------------------------------------
     generic (
-      NUMOFLANES                         : integer := MAXLINKWIDTH
+      NUMOFLANES                         : integer := MAXLINKWIDTH ;
+      SYMBOL_MODE                        : boolean := false
     );
     port (
       SerClk                             : in  std_logic;
+      SymClk                             : in  std_logic := '0';
 
       ParIn                              : in  LinkType(0 to NUMOFLANES-1)(ENCODEDWIDTH-1 downto 0) ;
       SerOut                             : out std_logic_vector (NUMOFLANES-1 downto 0);
@@ -133,6 +141,66 @@ package PcieComponentPkg is
     );
   end component PcieModelSerialiser ;
 
+  ------------------------------------------------------------
+  component PcieTlpStreamAdapter is
+  ------------------------------------------------------------
+    generic (
+      MODEL_ID_NAME                      : string  := "" ;
+      NUMOFLANES                         : integer := 1
+    );
+    port (
+      Clk                                : in  std_logic ;
+      nReset                             : in  std_logic ;
+
+      LinkFromModel                      : in  LinkType(0 to NUMOFLANES-1)(PIPEWIDTH-1 downto 0) ;
+      LinkToModel                        : out LinkType(0 to NUMOFLANES-1)(PIPEWIDTH-1 downto 0) ;
+
+      TlpOutData                         : out std_logic_vector (31 downto 0) ;
+      TlpOutSop                          : out std_logic ;
+      TlpOutEop                          : out std_logic ;
+      TlpOutValid                        : out std_logic ;
+      TlpOutReady                        : in  std_logic ;
+
+      TlpInData                          : in  std_logic_vector (31 downto 0) ;
+      TlpInSop                           : in  std_logic ;
+      TlpInEop                           : in  std_logic ;
+      TlpInValid                         : in  std_logic ;
+      TlpInReady                         : out std_logic
+    );
+  end component PcieTlpStreamAdapter ;
+
+  ------------------------------------------------------------
+  component PcieModelTlpStream is
+  ------------------------------------------------------------
+    generic (
+      MODEL_ID_NAME         : string  := "" ;
+      NODE_NUM              : integer := 8 ;
+      ENDPOINT              : boolean := false ;
+      REQ_ID                : integer := 0 ;
+      EN_TLP_REQ_DIGEST     : boolean := false ;
+      ENABLE_AUTO           : boolean := false ;
+      LINKWIDTH             : integer := 1
+    );
+    port (
+      Clk                   : in  std_logic;
+      nReset                : in  std_logic;
+
+      TransRec              : inout AddressBusRecType ;
+
+      TlpOutData            : out std_logic_vector (31 downto 0) ;
+      TlpOutSop             : out std_logic ;
+      TlpOutEop             : out std_logic ;
+      TlpOutValid           : out std_logic ;
+      TlpOutReady           : in  std_logic ;
+
+      TlpInData             : in  std_logic_vector (31 downto 0) ;
+      TlpInSop              : in  std_logic ;
+      TlpInEop              : in  std_logic ;
+      TlpInValid            : in  std_logic ;
+      TlpInReady            : out std_logic
+    );
+  end component PcieModelTlpStream ;
+
   ------------------------------------------------------------
   component PcieMonitor is
   ------------------------------------------------------------
@@ -14,6 +14,12 @@
 --
 --  Revision History:
 --    Date      Version    Description
+--    10/2026   2026.10    Added 8.0GT/s model to model LTSSM configuration
+--    10/2026   2026.10    Added TLP stream mode support, MPS/MRRS split bursts,
+--                         link utilisation monitor, block burst FIFO transfers,
+--                         packed transaction parameter transfers, blocking wait
+--                         for transactions with its status values and ASPM
+--                         LTSSM configuration
 --    06/2026   2026.07    Added support for DLLP and PHY traffic processing
 --    09/2025   2026.01    Initial revision
 --
@@ -89,6 +95,24 @@ package PcieInterfacePkg is
   constant DISABLE_SCRAMBLE_ADDR             : integer := 207 ;
   constant DISABLE_8B10B_ADDR                : integer := 208 ;
   constant GEN2_CLK_ADDR                     : integer := 209 ;
+  constant LINK_UTIL_SEL                     : integer := 210 ;
+  constant LINK_UTIL_COUNT                   : integer := 211 ;
+  constant LINK_UTIL_WINDOW                  : integer := 212 ;
+
+  constant LINK_UTIL_TLP                     : integer := 0 ;
+  constant LINK_UTIL_DLLP                    : integer := 1 ;
+  constant LINK_UTIL_OS                      : integer := 2 ;
+  constant LINK_UTIL_IDLE                    : integer := 3 ;
+  constant LINK_UTIL_ELEC_IDLE               : integer := 4 ;
+  constant LINK_UTIL_NUM_TYPES               : integer := 5 ;
+
+  constant LINK_UTIL_TX                      : integer := 0 ;
+  constant LINK_UTIL_RX                      : integer := 1 ;
+
+  constant LINK_UTIL_SEL_TYPE_BIT            : integer := 0 ;
+  constant LINK_UTIL_SEL_LANE_BIT            : integer := 4 ;
+  constant LINK_UTIL_SEL_DIR_BIT             : integer := 8 ;
+  constant LINK_UTIL_SEL_WIN_BIT             : integer := 9 ;
 
   --   ^    ^    ^    ^    ^    ^    ^    ^    ^    ^    ^    ^    ^    ^    ^    ^
   -- **** if the ../include/pcie_vhost_map.h values are updated, update the values above to match ****
@@ -123,6 +147,15 @@ package PcieInterfacePkg is
   constant PUSHRDATA                         : integer := 418 ;
   constant PUSHRDATA32                       : integer := 419 ;
   constant POPRDATA32                        : integer := 420 ;
+  constant POPWDATABURST                     : integer := 421 ;
+  constant PUSHRDATABURST                    : integer := 422 ;
+  constant GETTRANSBLOCK                     : integer := 423 ;
+  constant SETPARAMSBLOCK                    : integer := 424 ;
+  constant GETNEXTTRANSWAIT                  : integer := 425 ;
+
+  -- GETNEXTTRANSWAIT status (lower word) when no transaction is ready
+  constant TRANS_WAIT_TIMEOUT                : integer := -1 ;
+  constant TRANS_WAIT_LINK_ACTIVE            : integer := -2 ;
 
   ------------------------------------------------------------
   -- SetModelOptions for PCIe VC
@@ -242,6 +275,11 @@ package PcieInterfacePkg is
 
   constant CONFIG_DISP_BCK_NODE_NUM          : integer := 38 ;
 
+  constant CONFIG_LTSSM_GEN3_MODEL_ONLY      : integer := 39 ;
+  constant CONFIG_LTSSM_ASPM_CTL             : integer := 40 ;
+  constant CONFIG_LTSSM_ASPM_L0S_IDLE        : integer := 41 ;
+  constant CONFIG_LTSSM_ASPM_L1_IDLE         : integer := 42 ;
+
   constant CONFIG_DONT_CARE                  : integer :=  -1 ;
 
   ------------------------------------------------------------
@@ -316,6 +354,23 @@ package PcieInterfacePkg is
   -- PARAM_REQ_ADDRHI not included in parameter count but still required for decoding
   constant PARAM_REQ_ADDRHI                  : integer := PARAM_REQ_ADDR + 1;
 
+  ------------------------------------------------------------
+  -- 32 bit word offsets of the packed transaction record read
+  -- with GETTRANSBLOCK (little endian bytes). SETPARAMSBLOCK
+  -- takes pairs of 32 bit words: parameter index, then value.
+  ------------------------------------------------------------
+  constant TRANS_BLOCK_ADDR                  : integer := 0 ;
+  constant TRANS_BLOCK_ADDRHI                : integer := 1 ;
+  constant TRANS_BLOCK_ADDRWIDTH             : integer := 2 ;
+  constant TRANS_BLOCK_DATA                  : integer := 3 ;
+  constant TRANS_BLOCK_DATAHI                : integer := 4 ;
+  constant TRANS_BLOCK_DATAWIDTH             : integer := 5 ;
+  constant TRANS_BLOCK_OPTIONS               : integer := 6 ;
+  constant TRANS_BLOCK_INTTOMODEL            : integer := 7 ;
+  constant TRANS_BLOCK_BOOLTOMODEL           : integer := 8 ;
+  constant TRANS_BLOCK_PARAMS                : integer := 9 ;
+  constant TRANS_BLOCK_WORDS                 : integer := TRANS_BLOCK_PARAMS + NUM_PCIE_PARAMS ;
+
   ------------------------------------------------------------
   -- Parameter offsets when generating ordered sets
   ------------------------------------------------------------
@@ -489,6 +544,13 @@ package PcieInterfacePkg is
   ------------------------------------------------------------
   constant MAXLINKWIDTH                      : integer                       := 16 ;
   constant ENCODEDWIDTH                      : integer                       := 10 ;
+  constant PIPEWIDTH                         : integer                       := 9 ;
+
+  ------------------------------------------------------------
+  -- Default max payload and max read request sizes (bytes)
+  ------------------------------------------------------------
+  constant PCIE_DEFAULT_MPS                  : integer                       := 128 ;
+  constant PCIE_DEFAULT_MRRS                 : integer                       := 512 ;
 
   ------------------------------------------------------------
   subtype TagType is integer range 0 to 256;
@@ -544,6 +606,16 @@ package PcieInterfacePkg is
     vec                     : std_logic_vector
   ) return boolean ;
 
+  ------------------------------------------------------------
+  function PcieDecodeKSymbol  (
+  -- Function to return the 9 bit K symbol (K flag and byte) of
+  -- a lane symbol, or zero for data symbols. Only the K symbols
+  -- used by PCIe are decoded from 10 bit symbols.
+  ------------------------------------------------------------
+    sym                     : std_logic_vector ;
+    pipe                    : boolean
+  ) return std_logic_vector ;
+
   ------------------------------------------------------------
   procedure PcieTryWaitForTransaction (
   --
@@ -611,6 +683,48 @@ package PcieInterfacePkg is
              iTag            : In    TagType := TLP_TAG_AUTO
   ) ;
 
+  ------------------------------------------------------------
+  procedure PcieMemWriteBurst (
+  -- do PCIe Burst Write, split into max payload sized TLPs
+  ------------------------------------------------------------
+    signal   TransactionRec : InOut AddressBusRecType ;
+             iAddr          : In    std_logic_vector ;
+             iByteCount     : In    integer ;
+             iMaxPayload    : In    integer := PCIE_DEFAULT_MPS
+  ) ;
+
+  ------------------------------------------------------------
+  procedure PcieMemWriteBurst (
+  -- do PCIe Burst Write of a byte vector, split into max payload sized TLPs
+  ------------------------------------------------------------
+    signal   TransactionRec : InOut AddressBusRecType ;
+             iAddr          : In    std_logic_vector ;
+             iData          : In    slv_vector ;
+             iMaxPayload    : In    integer := PCIE_DEFAULT_MPS
+  ) ;
+
+  ------------------------------------------------------------
+  procedure PcieMemReadBurst (
+  -- do PCIe Burst Read, split into max read request sized TLPs
+  ------------------------------------------------------------
+    signal   TransactionRec  : InOut AddressBusRecType ;
+             iAddr           : In    std_logic_vector ;
+             iByteCount      : In    integer ;
+             oStatus         : Out   PcieStatusRecType ;
+             iMaxReadReq     : In    integer := PCIE_DEFAULT_MRRS
+  ) ;
+
+  ------------------------------------------------------------
+  procedure PcieMemReadBurst (
+  -- do PCIe Burst Read into a byte vector, split into max read request sized TLPs
+  ------------------------------------------------------------
+    signal   TransactionRec  : InOut AddressBusRecType ;
+             iAddr           : In    std_logic_vector ;
+             oData           : Out   slv_vector ;
+             oStatus         : Out   PcieStatusRecType ;
+             iMaxReadReq     : In    integer := PCIE_DEFAULT_MRRS
+  ) ;
+
   ------------------------------------------------------------
   procedure PcieMemReadLock (
   -- do PCIe Locked Memory Read Cycle
@@ -1149,6 +1263,21 @@ package PcieInterfacePkg is
 
   ) ;
 
+  ------------------------------------------------------------
+  procedure PcieGetAccessFromModel (
+  -- Variant returning the burst size of block transfers
+  ------------------------------------------------------------
+             node               : In    integer ;
+             VPData             : InOut integer ;
+             VPDataHi           : InOut integer ;
+             VPAddr             : InOut integer ;
+             VPOp               : Out   integer ;
+             VPBurstSize        : Out   integer ;
+             VPDone             : Out   integer ;
+             VPError            : Out   integer
+
+  ) ;
+
 end package PcieInterfacePkg ;
 
 -- ***********************************************************
@@ -1174,6 +1303,65 @@ package body PcieInterfacePkg is
 
   end function has_all_z ;
 
+  ------------------------------------------------------------
+  function PcieDecodeKSymbol (sym : std_logic_vector ; pipe : boolean) return std_logic_vector is
+  ------------------------------------------------------------
+  variable s     : std_logic_vector (sym'length-1 downto 0) := sym ;
+  variable six   : std_logic_vector (5 downto 0) ;
+  variable four  : std_logic_vector (3 downto 0) ;
+  variable x     : integer ;
+  variable rdneg : boolean ;
+
+  -- fghj codes of K28.0 to K28.7 for 6 bit codes 001111 and 110000
+  type     FourBTableType is array (0 to 7) of std_logic_vector (3 downto 0) ;
+  constant K28_NEG : FourBTableType := ("0100", "1001", "0101", "0011", "0010", "1010", "0110", "1000") ;
+  constant K28_POS : FourBTableType := ("1011", "0110", "1010", "1100", "1101", "0101", "1001", "0111") ;
+  begin
+
+    if is_X(s) then
+      return 9x"000" ;
+    end if ;
+
+    if pipe then
+      if s(8) = '1' then
+        return s(8 downto 0) ;
+      else
+        return 9x"000" ;
+      end if ;
+    end if ;
+
+    -- 10 bit symbols have bit a of abcdei fghj in bit 0
+    six  := s(0) & s(1) & s(2) & s(3) & s(4) & s(5) ;
+    four := s(6) & s(7) & s(8) & s(9) ;
+
+    case six is
+      when "001111" => x := 28 ; rdneg := true ;
+      when "110000" => x := 28 ; rdneg := false ;
+      when "111010" => x := 23 ; rdneg := true ;
+      when "000101" => x := 23 ; rdneg := false ;
+      when "110110" => x := 27 ; rdneg := true ;
+      when "001001" => x := 27 ; rdneg := false ;
+      when "101110" => x := 29 ; rdneg := true ;
+      when "010001" => x := 29 ; rdneg := false ;
+      when "011110" => x := 30 ; rdneg := true ;
+      when "100001" => x := 30 ; rdneg := false ;
+      when others   => return 9x"000" ;
+    end case ;
+
+    if x = 28 then
+      for y in 0 to 7 loop
+        if (rdneg and four = K28_NEG(y)) or (not rdneg and four = K28_POS(y)) then
+          return '1' & std_logic_vector(to_unsigned(y*32 + x, 8)) ;
+        end if ;
+      end loop ;
+    elsif (rdneg and four = "1000") or (not rdneg and four = "0111") then
+      return '1' & std_logic_vector(to_unsigned(7*32 + x, 8)) ;
+    end if ;
+
+    return 9x"000" ;
+
+  end function PcieDecodeKSymbol ;
+
   ------------------------------------------------------------
   procedure PcieTryWaitForTransaction (
   -- Non-blocking wait for a new Transaction request, returning
@@ -1215,11 +1403,30 @@ package body PcieInterfacePkg is
              VPDone             : Out   integer ;
              VPError            : Out   integer
 
+  ) is
+    variable UnusedVPBurstSize : integer := 0 ;
+  begin
+
+    PcieGetAccessFromModel (node, VPData, VPDataHi, VPAddr, VPOp, UnusedVPBurstSize, VPDone, VPError) ;
+
+  end procedure PcieGetAccessFromModel ;
+
+  ------------------------------------------------------------
+  procedure PcieGetAccessFromModel (
+  ------------------------------------------------------------
+             node               : In    integer ;
+             VPData             : InOut integer ;
+             VPDataHi           : InOut integer ;
+             VPAddr             : InOut integer ;
+             VPOp               : Out   integer ;
+             VPBurstSize        : Out   integer ;
+             VPDone             : Out   integer ;
+             VPError            : Out   integer
+
   ) is
     variable UnusedVPDataWidth : integer := 0 ;
     variable UnusedVPAddrHi    : integer := 0 ;
     variable UnusedVPAddrWidth : integer := 0 ;
-    variable UnusedVPBurstSize : integer := 0 ;
     variable UnusedVPTicks     : integer := 0 ;
     variable UnusedVPParam     : integer := 0 ;
     variable UnusedVPStatus    : integer := 0 ;
@@ -1231,7 +1438,7 @@ package body PcieInterfacePkg is
     VTrans (node,   UnusedIntReq,      UnusedVPStatus,  UnusedVPCount, UnusedCount,
             VPData, VPDataHi,          UnusedVPDataWidth,
             VPAddr, UnusedVPAddrHi,    UnusedVPAddrWidth,
-            VPOp,   UnusedVPBurstSize, UnusedVPTicks,
+            VPOp,   VPBurstSize,       UnusedVPTicks,
             VPDone, VPError,           UnusedVPParam) ;
 
   end procedure PcieGetAccessFromModel ;
@@ -1352,6 +1559,114 @@ package body PcieInterfacePkg is
 
   end procedure PcieMemRead ;
 
+  ------------------------------------------------------------
+  procedure PcieMemWriteBurst (
+  -- do PCIe Burst Write, split into max payload sized TLPs
+  ------------------------------------------------------------
+    signal   TransactionRec : InOut AddressBusRecType ;
+             iAddr          : In    std_logic_vector ;
+             iByteCount     : In    integer ;
+             iMaxPayload    : In    integer := PCIE_DEFAULT_MPS
+  ) is
+    variable Addr           : std_logic_vector (iAddr'length-1 downto 0) := iAddr ;
+    variable Remaining      : integer := iByteCount ;
+    variable Chunk          : integer ;
+  begin
+
+    -- Split on max payload boundaries, which also keeps each TLP within a 4K page.
+    -- Write data is popped from the burst FIFO in order by each TLP.
+    while Remaining > 0 loop
+      Chunk     := minimum(Remaining, iMaxPayload - (to_integer(Addr(11 downto 0)) mod iMaxPayload)) ;
+
+      PcieMemWrite(TransactionRec, Addr, Chunk) ;
+
+      Addr      := Addr + Chunk ;
+      Remaining := Remaining - Chunk ;
+    end loop ;
+
+  end procedure PcieMemWriteBurst ;
+
+  ------------------------------------------------------------
+  procedure PcieMemWriteBurst (
+  -- do PCIe Burst Write of a byte vector, split into max payload sized TLPs
+  ------------------------------------------------------------
+    signal   TransactionRec : InOut AddressBusRecType ;
+             iAddr          : In    std_logic_vector ;
+             iData          : In    slv_vector ;
+             iMaxPayload    : In    integer := PCIE_DEFAULT_MPS
+  ) is
+  begin
+
+    -- Load the whole payload into the burst FIFO, for the model to fetch as a block per TLP
+    for idx in iData'range loop
+      Push(TransactionRec.WriteBurstFifo, SafeResize(iData(idx), 8)) ;
+    end loop ;
+
+    PcieMemWriteBurst(TransactionRec, iAddr, iData'length, iMaxPayload) ;
+
+  end procedure PcieMemWriteBurst ;
+
+  ------------------------------------------------------------
+  procedure PcieMemReadBurst (
+  -- do PCIe Burst Read, split into max read request sized TLPs
+  ------------------------------------------------------------
+    signal   TransactionRec  : InOut AddressBusRecType ;
+             iAddr           : In    std_logic_vector ;
+             iByteCount      : In    integer ;
+             oStatus         : Out   PcieStatusRecType ;
+             iMaxReadReq     : In    integer := PCIE_DEFAULT_MRRS
+  ) is
+    variable Addr            : std_logic_vector (iAddr'length-1 downto 0) := iAddr ;
+    variable Remaining       : integer := iByteCount ;
+    variable Chunk           : integer ;
+    variable Status          : PcieStatusRecType := (Packet => 0, Completion => 0, Tag => 0) ;
+  begin
+
+    -- Read data is pushed to the burst FIFO in order by each request's completions.
+    -- Stop at the first request that does not complete successfully.
+    while Remaining > 0 loop
+      Chunk     := minimum(Remaining, iMaxReadReq - (to_integer(Addr(11 downto 0)) mod iMaxReadReq)) ;
+
+      PcieMemRead(TransactionRec, Addr, Chunk, Status) ;
+
+      exit when Status.Packet /= 0 or Status.Completion /= 0 ;
+
+      Addr      := Addr + Chunk ;
+      Remaining := Remaining - Chunk ;
+    end loop ;
+
+    oStatus := Status ;
+
+  end procedure PcieMemReadBurst ;
+
+  ------------------------------------------------------------
+  procedure PcieMemReadBurst (
+  -- do PCIe Burst Read into a byte vector, split into max read request sized TLPs
+  ------------------------------------------------------------
+    signal   TransactionRec  : InOut AddressBusRecType ;
+             iAddr           : In    std_logic_vector ;
+             oData           : Out   slv_vector ;
+             oStatus         : Out   PcieStatusRecType ;
+             iMaxReadReq     : In    integer := PCIE_DEFAULT_MRRS
+  ) is
+    variable Status          : PcieStatusRecType ;
+  begin
+
+    PcieMemReadBurst(TransactionRec, iAddr, oData'length, Status, iMaxReadReq) ;
+
+    -- Unload the completion data, with bytes of failed requests left unknown
+    for idx in oData'range loop
+      if Empty(TransactionRec.ReadBurstFifo) then
+        oData(idx) := (oData(idx)'range => 'X') ;
+      else
+        oData(idx) := SafeResize(Pop(TransactionRec.ReadBurstFifo), oData(idx)'length) ;
+      end if ;
+    end loop ;
+
+    oStatus := Status ;
+
+  end procedure PcieMemReadBurst ;
+
   ------------------------------------------------------------
   procedure PcieMemReadLock (
   -- do PCIe Memory Read Cycle
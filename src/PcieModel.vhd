@@ -13,6 +13,10 @@
 --
 --  Revision History:
 --    Date      Version    Description
+--    10/2026   2026.10    Added per lane link utilisation monitor (enabled by
+--                         generic), block burst FIFO transfers, packed
+--                         transaction parameter transfers and blocking wait
+--                         for transactions, woken by link partner activity
 --    06/2026   2026.07    Added support for DLLP and PHY traffic processing
 --    07/2025   2026.01    Initial version
 --
@@ -41,6 +45,7 @@ library ieee ;
 
 library std;
 use std.env.all;
+use std.textio.all;
 
 library osvvm ;
   context osvvm.OsvvmContext ;
@@ -66,7 +71,9 @@ generic (
   DISABLE_SCRAMBLING : boolean := false ; -- true if output to have no scrambling
   GEN2_CLK           : boolean := false ; -- true if input clock at GEN2 speed (500MHz)
   ENABLE_INIT_PHY    : boolean := true  ; -- true if PHY layer link training is to be enabled
-  ENABLE_AUTO        : boolean := false   -- true if PCIe automatic features are to be enabled
+  ENABLE_AUTO        : boolean := false ; -- true if PCIe automatic features are to be enabled
+  LINK_UTIL_ENABLE   : boolean := false ; -- true to enable the link utilisation monitor (implied by LINK_UTIL_FILE)
+  LINK_UTIL_FILE     : string  := ""      -- if not empty, file for link utilisation time series, one line per window
 ) ;
 port (
   -- Globals
@@ -118,6 +125,80 @@ architecture behavioral of PcieModel is
 
   signal   ClkDiv2       : std_logic                                        := '0' ;
 
+  -- Link utilisation symbol counts, indexed by direction, lane and symbol class
+  type     UtilCountType is array (natural range <>) of integer ;
+
+  constant UTIL_NUM_COUNTS : integer                                        := 2 * LINKWIDTH * LINK_UTIL_NUM_TYPES ;
+
+  constant SYM_STP       : std_logic_vector (8 downto 0)                    := 9x"1FB" ;  -- K27.7
+  constant SYM_SDP       : std_logic_vector (8 downto 0)                    := 9x"15C" ;  -- K28.2
+  constant SYM_END       : std_logic_vector (8 downto 0)                    := 9x"1FD" ;  -- K29.7
+  constant SYM_EDB       : std_logic_vector (8 downto 0)                    := 9x"1FE" ;  -- K30.7
+  constant SYM_COM       : std_logic_vector (8 downto 0)                    := 9x"1BC" ;  -- K28.5
+  constant SYM_SKP       : std_logic_vector (8 downto 0)                    := 9x"11C" ;  -- K28.0
+  constant SYM_FTS       : std_logic_vector (8 downto 0)                    := 9x"13C" ;  -- K28.1
+  constant SYM_IDL       : std_logic_vector (8 downto 0)                    := 9x"17C" ;  -- K28.3
+  constant SYM_EIE       : std_logic_vector (8 downto 0)                    := 9x"1FC" ;  -- K28.7
+
+  -- 8b10b code groups (bit 0 = a) of the SKP ordered set symbols for each running disparity
+  constant COM_10B_NEG   : std_logic_vector (9 downto 0)                    := 10x"17C" ;
+  constant COM_10B_POS   : std_logic_vector (9 downto 0)                    := 10x"283" ;
+  constant SKP_10B_NEG   : std_logic_vector (9 downto 0)                    := 10x"0BC" ;
+  constant SKP_10B_POS   : std_logic_vector (9 downto 0)                    := 10x"343" ;
+  constant SKP_OS_LENGTH : integer                                          := 4 ;  -- COM and three SKPs
+
+  signal   UtilCount     : UtilCountType(0 to UTIL_NUM_COUNTS-1)            := (others => 0) ;
+  signal   UtilLast      : UtilCountType(0 to UTIL_NUM_COUNTS-1)            := (others => 0) ;
+  signal   UtilWindow    : integer                                          := 0 ;
+  signal   UtilRestart   : boolean                                          := false ;
+
+  -- Per lane received symbols held by GETNEXTTRANSWAIT, and the last two SKP
+  -- ordered sets (COM and first SKP) received whilst waiting
+  constant RX_SKID_DEPTH : integer                                          := 16 ;
+  type     RxSkidType    is array (natural range <>) of LinkType(0 to RX_SKID_DEPTH-1)(LANEWIDTH-1 downto 0) ;
+  type     RxOsType      is array (natural range <>) of LinkType(0 to 3)(LANEWIDTH-1 downto 0) ;
+
+  ------------------------------------------------------------
+  -- Lane symbol Idx (0 for COM, 1 to 3 for SKP) of a SKP ordered
+  -- set, for the lane's running disparity when 8b10b encoded
+  ------------------------------------------------------------
+  function SkpOsSymbol (Idx : integer ; RdPos : boolean) return std_logic_vector is
+  begin
+    if PIPE then
+      if Idx = 0 then
+        return SafeResize(SYM_COM, LANEWIDTH) ;
+      else
+        return SafeResize(SYM_SKP, LANEWIDTH) ;
+      end if ;
+    elsif Idx = 0 then
+      if RdPos then
+        return SafeResize(COM_10B_POS, LANEWIDTH) ;
+      else
+        return SafeResize(COM_10B_NEG, LANEWIDTH) ;
+      end if ;
+    elsif RdPos then
+      return SafeResize(SKP_10B_POS, LANEWIDTH) ;
+    else
+      return SafeResize(SKP_10B_NEG, LANEWIDTH) ;
+    end if ;
+  end function SkpOsSymbol ;
+
+  ------------------------------------------------------------
+  -- Position in a received SKP ordered set of a lane's decoded
+  -- symbol following one at position Prev (0 when not in a SKP
+  -- ordered set, 1 for COM and 2 for SKP)
+  ------------------------------------------------------------
+  function RxOsPosition (KSym : std_logic_vector ; Prev : integer) return integer is
+  begin
+    if KSym = SYM_COM then
+      return 1 ;
+    elsif KSym = SYM_SKP and Prev > 0 then
+      return 2 ;
+    else
+      return 0 ;
+    end if ;
+  end function RxOsPosition ;
+
 begin
 
   ClockCounter : process(Clk)
@@ -192,6 +273,8 @@ begin
     variable VPOp              : integer                        := 0 ;
     variable VPDone            : integer                        := 0 ;
     variable VPError           : integer                        := 0 ;
+    variable VPBurstSize       : integer                        := 0 ;
+    variable VPByte            : integer                        := 0 ;
 
     variable Delta             : boolean                        := false;
     variable WE                : boolean                        := false;
@@ -204,6 +287,90 @@ begin
     variable TransUnavail      : boolean ;
     variable NoAck             : boolean ;
 
+    variable UtilSel           : integer                        := 0 ;
+    variable UtilIdx           : integer                        := 0 ;
+
+    variable BlkWord           : std_logic_vector (31 downto 0) := (others => '0') ;
+    variable BlkIdx            : integer                        := 0 ;
+    variable BlkVal            : integer                        := 0 ;
+
+    variable TxRdPos           : boolean_vector(0 to LINKWIDTH-1) := (others => false) ;
+    variable TxOsSym           : integer_vector(0 to LINKWIDTH-1) := (others => 0) ;
+    variable WaitCycles        : integer                        := 0 ;
+    variable OsSym             : integer                        := 0 ;
+    variable OsOdd             : boolean                        := false ;
+
+    variable RxSkid            : RxSkidType(0 to LINKWIDTH-1) ;
+    variable RxSkidLen         : integer_vector(0 to LINKWIDTH-1) := (others => 0) ;
+    variable RxOs              : RxOsType(0 to LINKWIDTH-1) ;
+    variable RxOsCount         : integer_vector(0 to LINKWIDTH-1) := (others => 0) ;
+    variable RxOsSym           : integer_vector(0 to LINKWIDTH-1) := (others => 0) ;
+    variable RxPendCom         : LinkType(0 to LINKWIDTH-1)(LANEWIDTH-1 downto 0) ;
+    variable RxActive          : boolean                        := false ;
+    variable RxSym             : std_logic_vector (LANEWIDTH-1 downto 0) ;
+    variable RxKSym            : std_logic_vector (8 downto 0) ;
+    variable TxKSym            : std_logic_vector (8 downto 0) ;
+
+    -- Add a received symbol to the end of a lane's held symbols
+    procedure PushRx (Lane : integer ; Sym : std_logic_vector) is
+    begin
+      if RxSkidLen(Lane) < RX_SKID_DEPTH then
+        RxSkid(Lane)(RxSkidLen(Lane)) := Sym ;
+        RxSkidLen(Lane)               := RxSkidLen(Lane) + 1 ;
+      else
+        Alert(ModelID, "GETNEXTTRANSWAIT received symbol hold overflow on lane " & to_string(Lane) &
+                       ", with a symbol lost", ERROR) ;
+      end if ;
+    end procedure PushRx ;
+
+    -- Word of the packed transaction record fetched with GETTRANSBLOCK
+    impure function TransBlockWord (Idx : integer) return std_logic_vector is
+      variable Addr : std_logic_vector (63 downto 0) := SafeResize(TransRec.Address,     64) ;
+      variable Data : std_logic_vector (63 downto 0) := SafeResize(TransRec.DataToModel, 64) ;
+    begin
+      case Idx is
+        when TRANS_BLOCK_ADDR        => return Addr(31 downto  0) ;
+        when TRANS_BLOCK_ADDRHI      => return Addr(63 downto 32) ;
+        when TRANS_BLOCK_ADDRWIDTH   => return std_logic_vector(to_signed(TransRec.AddrWidth,  32)) ;
+        when TRANS_BLOCK_DATA        => return Data(31 downto  0) ;
+        when TRANS_BLOCK_DATAHI      => return Data(63 downto 32) ;
+        when TRANS_BLOCK_DATAWIDTH   => return std_logic_vector(to_signed(TransRec.DataWidth,  32)) ;
+        when TRANS_BLOCK_OPTIONS     => return std_logic_vector(to_signed(TransRec.Options,    32)) ;
+        when TRANS_BLOCK_INTTOMODEL  => return std_logic_vector(to_signed(TransRec.IntToModel, 32)) ;
+        when TRANS_BLOCK_BOOLTOMODEL =>
+          if TransRec.BoolToModel then
+            return 32x"1" ;
+          end if ;
+        when others                  =>
+          if Idx >= TRANS_BLOCK_PARAMS and Idx < TRANS_BLOCK_WORDS then
+            return std_logic_vector(to_signed(Get(TransRec.Params, Idx - TRANS_BLOCK_PARAMS), 32)) ;
+          end if ;
+      end case ;
+      return 32x"0" ;
+    end function TransBlockWord ;
+
+    -- Update a transaction parameter, as for SETPARAMS
+    procedure SetTransParam (Idx : integer ; Val : integer) is
+    begin
+      -- When updating the address, construct as a 64-bit value
+      if Idx = PARAM_REQ_ADDR then
+          WrData := std_logic_vector(to_unsigned(0, WrData'length)) ;
+          WrData(31 downto 0) := SafeResize(std_logic_vector(to_signed(Val, 32)), 32) ;
+          Set(TransRec.Params, PARAM_REQ_ADDR, WrData) ;
+
+      -- If upper address bits being set, add to WrData upper bits and re-write the address parameter
+      elsif Idx = PARAM_REQ_ADDRHI then
+
+          WrData(63 downto 32) :=  SafeResize(std_logic_vector(to_signed(Val, 32)), 32) ;
+          Set(TransRec.Params, PARAM_REQ_ADDR, WrData) ;
+
+      else
+
+          Set(TransRec.Params, Idx, Val) ;
+
+      end if ;
+    end procedure SetTransParam ;
+
   begin
 
     wait until Initialised = true;
@@ -215,10 +382,12 @@ begin
       VPDataHi := to_integer(signed(RdData(63 downto 32))) ;
 
       -- Fetch the next access from the PCIe model
-      PcieGetAccessFromModel (NODE_NUM, VPData, VPDataHi, VPAddr, VPOp, VPDone, VPError) ;
+      PcieGetAccessFromModel (NODE_NUM, VPData, VPDataHi, VPAddr, VPOp, VPBurstSize, VPDone, VPError) ;
 
       Delta := AddressBusOperationType'val(VPOp) = READ_OP  or    -- treat all reads as asynchronous (delta-cycle) accesses
-               AddressBusOperationType'val(VPOp) = ASYNC_WRITE ;
+               AddressBusOperationType'val(VPOp) = ASYNC_WRITE or
+               VPAddr = POPWDATABURST or VPAddr = PUSHRDATABURST or  -- block transfers take no time
+               VPAddr = GETTRANSBLOCK or VPAddr = SETPARAMSBLOCK ;
 
       WE    := AddressBusOperationType'val(VPOp) = WRITE_OP or
                AddressBusOperationType'val(VPOp) = ASYNC_WRITE ;
@@ -269,10 +438,50 @@ begin
 
             if WE then
               LinkOutVec(LinkOffset) <= SafeResize(std_logic_vector(to_signed(VPData, 32)), LinkOutVec(LinkOffset)'length) xor InvertOutVec ;
+
+              -- Track the lane's running disparity from the COM symbols sent, and whether a whole
+              -- SKP ordered set was the last thing sent, for GETNEXTTRANSWAIT
+              if VPData = to_integer(unsigned(COM_10B_NEG)) then
+                TxRdPos(LinkOffset) := true ;
+              elsif VPData = to_integer(unsigned(COM_10B_POS)) then
+                TxRdPos(LinkOffset) := false ;
+              end if ;
+
+              TxKSym := PcieDecodeKSymbol(SafeResize(std_logic_vector(to_signed(VPData, 32)), LANEWIDTH), PIPE) ;
+
+              if TxKSym = SYM_COM then
+                TxOsSym(LinkOffset) := 1 ;
+              elsif TxKSym = SYM_SKP and TxOsSym(LinkOffset) > 0 and TxOsSym(LinkOffset) < SKP_OS_LENGTH then
+                TxOsSym(LinkOffset) := TxOsSym(LinkOffset) + 1 ;
+              else
+                TxOsSym(LinkOffset) := 0 ;
+              end if ;
             end if;
 
-            if not is_X(LinkInVec(LinkOffset)) then
-              RdData := SafeResize(LinkInVec(LinkOffset) xor InvertInVec, RdData'length) ;
+            -- Symbols held by GETNEXTTRANSWAIT are returned first, with the lane's input held in
+            -- their place unless a SKP after the first of an ordered set, which is removed to
+            -- drain the held symbols, as for clock compensation
+            if RxSkidLen(LinkOffset) = 0 then
+              RxSym := LinkInVec(LinkOffset) ;
+            else
+              RxSym := RxSkid(LinkOffset)(0) ;
+
+              if WE then
+                RxSkid(LinkOffset)(0 to RX_SKID_DEPTH-2) := RxSkid(LinkOffset)(1 to RX_SKID_DEPTH-1) ;
+                RxSkidLen(LinkOffset)                    := RxSkidLen(LinkOffset) - 1 ;
+
+                RxKSym := PcieDecodeKSymbol(LinkInVec(LinkOffset) xor InvertInVec, PIPE) ;
+
+                if RxKSym /= SYM_SKP or RxOsSym(LinkOffset) /= 2 then
+                  PushRx(LinkOffset, LinkInVec(LinkOffset)) ;
+                end if ;
+
+                RxOsSym(LinkOffset) := RxOsPosition(RxKSym, RxOsSym(LinkOffset)) ;
+              end if ;
+            end if ;
+
+            if not is_X(RxSym) then
+              RdData := SafeResize(RxSym xor InvertInVec, RdData'length) ;
             end if ;
 
         when LINK_STATE  =>
@@ -290,6 +499,44 @@ begin
            RdData(ElecIdleIn'length-1  downto  0) := ElecIdleIn;  -- lower half of word
            RdData(RxDetect'length+15   downto 16) := RxDetect;    -- upper half of word
 
+        -- -----------------------------------------------------
+        -- Process link utilisation monitor accesses
+        -- -----------------------------------------------------
+
+        when LINK_UTIL_SEL =>
+
+          if WE then
+            UtilSel := VPData ;
+          end if ;
+
+          RdData := SafeResize(std_logic_vector(to_signed(UtilSel, 32)), RdData'length) ;
+
+        when LINK_UTIL_COUNT =>
+
+          -- Select fields are the symbol class, lane, direction and whether the last complete window
+          UtilIdx := (((UtilSel / 2**LINK_UTIL_SEL_DIR_BIT) mod 2) * LINKWIDTH + ((UtilSel / 2**LINK_UTIL_SEL_LANE_BIT) mod 16)) *
+                     LINK_UTIL_NUM_TYPES + (UtilSel mod 16) ;
+
+          RdData  := (others => '0') ;
+
+          if ((UtilSel / 2**LINK_UTIL_SEL_LANE_BIT) mod 16) < LINKWIDTH and (UtilSel mod 16) < LINK_UTIL_NUM_TYPES then
+            if ((UtilSel / 2**LINK_UTIL_SEL_WIN_BIT) mod 2) = 1 then
+              RdData := SafeResize(std_logic_vector(to_signed(UtilLast(UtilIdx), 32)), RdData'length) ;
+            else
+              RdData := SafeResize(std_logic_vector(to_signed(UtilCount(UtilIdx), 32)), RdData'length) ;
+            end if ;
+          end if ;
+
+        when LINK_UTIL_WINDOW =>
+
+          -- Writing the window length also restarts all the counts
+          if WE then
+            UtilWindow  <= VPData ;
+            UtilRestart <= not UtilRestart ;
+          end if ;
+
+          RdData := SafeResize(std_logic_vector(to_signed(UtilWindow, 32)), RdData'length) ;
+
         when PVH_INVERT =>
 
           DataLoBits     := SafeResize(std_logic_vector(to_unsigned(VPData mod 16, 4)), DataLoBits'length) ;
@@ -333,6 +580,142 @@ begin
             RdData := SafeResize(std_logic_vector(to_unsigned(AddressBusOperationType'pos(TransRec.Operation), 32)), RdData'length) ;
           end if;
 
+        -- Blocking wait for a transaction, returning when one is ready, after VPData cycles if
+        -- non-zero, or when the link partner becomes active, with the cycles waited in the upper
+        -- word. The model must have just sent a SKP ordered set, and SKP ordered sets are
+        -- transmitted while waiting, in pairs so that the running disparity is unchanged and, as
+        -- COM resets the scrambler, leaving the model's scrambler state valid when it resumes.
+        --
+        -- The partner is active when sending anything other than electrical idle or SKP ordered
+        -- sets, which leave its scrambler unchanged. Its symbols from then until the wait ends are
+        -- held, after the last one or two SKP ordered sets it sent whilst waiting (for its running
+        -- disparity and scrambler reset), and returned by the following LINKADDR accesses so that
+        -- none are lost. The model must then clock the link normally, and the wait returns
+        -- TRANS_WAIT_LINK_ACTIVE (unless a transaction is ready) until all are returned.
+
+        when GETNEXTTRANSWAIT =>
+
+          WaitCycles := 0 ;
+          OsSym      := 0 ;
+          OsOdd      := false ;
+          RxActive   := RxSkidLen(0) > 0 ;
+
+          if not RxActive then
+            RxOsCount := (others => 0) ;
+            RxOsSym   := (others => 0) ;
+          end if ;
+
+          loop
+            -- Allow any new request ready to propagate
+            wait for 0 ns ;
+
+            if not RxActive then
+              for lane in 0 to LINKWIDTH-1 loop
+                RxKSym := PcieDecodeKSymbol(LinkInVec(lane) xor InvertInVec, PIPE) ;
+
+                if not is_X(LinkInVec(lane)) and
+                   ((RxKSym /= SYM_COM and RxKSym /= SYM_SKP) or (RxOsSym(lane) = 1 and RxKSym /= SYM_SKP)) then
+                  RxActive := true ;
+                end if ;
+              end loop ;
+
+              for lane in 0 to LINKWIDTH-1 loop
+                RxKSym := PcieDecodeKSymbol(LinkInVec(lane) xor InvertInVec, PIPE) ;
+
+                if RxActive then
+                  -- Hold the SKP ordered sets, and any COM starting the partner's activity
+                  if RxOsCount(lane) > 0 and RxOsCount(lane) mod 2 = 0 then
+                    PushRx(lane, RxOs(lane)(0)) ;
+                    PushRx(lane, RxOs(lane)(1)) ;
+                  end if ;
+
+                  if RxOsCount(lane) > 0 then
+                    PushRx(lane, RxOs(lane)(2)) ;
+                    PushRx(lane, RxOs(lane)(3)) ;
+                  end if ;
+
+                  if RxOsSym(lane) = 1 then
+                    PushRx(lane, RxPendCom(lane)) ;
+                  end if ;
+
+                else
+                  -- Record the partner's SKP ordered sets
+                  if RxKSym = SYM_COM then
+                    RxPendCom(lane) := LinkInVec(lane) ;
+                  elsif RxKSym = SYM_SKP and RxOsSym(lane) = 1 then
+                    RxOs(lane)(0 to 1) := RxOs(lane)(2 to 3) ;
+                    RxOs(lane)(2)      := RxPendCom(lane) ;
+                    RxOs(lane)(3)      := LinkInVec(lane) ;
+                    RxOsCount(lane)    := RxOsCount(lane) + 1 ;
+                  end if ;
+
+                  RxOsSym(lane) := RxOsPosition(RxKSym, RxOsSym(lane)) ;
+                end if ;
+              end loop ;
+            end if ;
+
+            exit when OsSym = 0 and not OsOdd and
+                      (RxActive or TransRec.Rdy /= TransRec.Ack or (VPData > 0 and WaitCycles >= VPData)) ;
+
+            -- Hold the partner's symbols until the wait ends, with the symbols of the last cycle
+            -- returned by the model's LINKADDR accesses
+            if RxActive then
+              for lane in 0 to LINKWIDTH-1 loop
+                PushRx(lane, LinkInVec(lane)) ;
+                RxOsSym(lane) := RxOsPosition(PcieDecodeKSymbol(LinkInVec(lane) xor InvertInVec, PIPE), RxOsSym(lane)) ;
+              end loop ;
+            end if ;
+
+            -- The lane running disparities and the scrambler state are only known after a SKP ordered set
+            if WaitCycles = 0 then
+              for lane in 0 to LINKWIDTH-1 loop
+                if TxOsSym(lane) /= SKP_OS_LENGTH then
+                  Alert(ModelID, "GETNEXTTRANSWAIT without a SKP ordered set just sent on lane " & to_string(lane) &
+                                 ", so its running disparity and scrambler state are stale", ERROR) ;
+                end if ;
+              end loop ;
+            end if ;
+
+            for lane in 0 to LINKWIDTH-1 loop
+              LinkOutVec(lane) <= SkpOsSymbol(OsSym, TxRdPos(lane)) xor InvertOutVec ;
+
+              if OsSym = 0 then
+                TxRdPos(lane) := not TxRdPos(lane) ;
+              end if ;
+            end loop ;
+
+            if OsSym = 0 then
+              OsOdd := not OsOdd ;
+            end if ;
+
+            OsSym      := (OsSym + 1) mod 4 ;
+            WaitCycles := WaitCycles + 1 ;
+
+            wait until rising_edge(ClkOut) ;
+          end loop ;
+
+          -- Whole SKP ordered sets were sent if waiting
+          if WaitCycles > 0 then
+            TxOsSym := (others => SKP_OS_LENGTH) ;
+          end if ;
+
+          PcieTryWaitForTransaction (
+               Clk          => ClkOut,
+               Rdy          => TransRec.Rdy,
+               Ack          => TransRec.Ack,
+               TransUnavail => TransUnavail
+            ) ;
+
+          if not TransUnavail then
+            RdData(31 downto 0) := std_logic_vector(to_unsigned(AddressBusOperationType'pos(TransRec.Operation), 32)) ;
+          elsif RxActive then
+            RdData(31 downto 0) := std_logic_vector(to_signed(TRANS_WAIT_LINK_ACTIVE, 32)) ;
+          else
+            RdData(31 downto 0) := std_logic_vector(to_signed(TRANS_WAIT_TIMEOUT, 32)) ;
+          end if;
+
+          RdData(63 downto 32) := std_logic_vector(to_unsigned(WaitCycles, 32)) ;
+
         when GETINTTOMODEL =>
 
           RdData := SafeResize(std_logic_vector(to_signed(TransRec.IntToModel, 32)), RdData'length) ;
@@ -390,23 +773,35 @@ begin
 
         when SETPARAMS =>
 
-            -- When updating the address, construct as a 64-bit value
-            if VPDataHi = PARAM_REQ_ADDR then
-                WrData := std_logic_vector(to_unsigned(0, WrData'length)) ;
-                WrData(31 downto 0) := SafeResize(std_logic_vector(to_signed(VPData, 32)), 32) ;
-                Set(TransRec.Params, PARAM_REQ_ADDR, WrData) ;
+            SetTransParam(VPDataHi, VPData) ;
 
-            -- If upper address bits being set, add to WrData upper bits and re-write the address parameter
-            elsif VPDataHi = PARAM_REQ_ADDRHI then
+        -- Packed transaction record fetch and parameter write-back, each as a single block access
 
-                WrData(63 downto 32) :=  SafeResize(std_logic_vector(to_signed(VPData, 32)), 32) ;
-                Set(TransRec.Params, PARAM_REQ_ADDR, WrData) ;
+        when GETTRANSBLOCK =>
 
-            else
+          for idx in 0 to VPBurstSize-1 loop
+            if idx mod 4 = 0 then
+              BlkWord := TransBlockWord(idx / 4) ;
+            end if ;
+            VSetBurstRdByte(NODE_NUM, idx, to_integer(unsigned(BlkWord(8*(idx mod 4)+7 downto 8*(idx mod 4))))) ;
+          end loop ;
+
+        when SETPARAMSBLOCK =>
 
-                Set(TransRec.Params, VPDataHi, VPData) ;
+          for word in 0 to VPBurstSize/4-1 loop
+            BlkWord := (others => '0') ;
+            for byte in 0 to 3 loop
+              VGetBurstWrByte(NODE_NUM, word*4 + byte, VPByte) ;
+              BlkWord(8*byte+7 downto 8*byte) := std_logic_vector(to_unsigned(VPByte mod 256, 8)) ;
+            end loop ;
 
+            if word mod 2 = 0 then
+              BlkIdx := to_integer(signed(BlkWord)) ;
+            else
+              BlkVal := to_integer(signed(BlkWord)) ;
+              SetTransParam(BlkIdx, BlkVal) ;
             end if ;
+          end loop ;
 
         when POPWDATA =>
 
@@ -438,6 +833,31 @@ begin
 
           RdData(31 downto 0) := Pop(TransRec.ReadBurstFifo) ;
 
+        -- Block transfers of VPBurstSize bytes between the burst FIFOs and the model
+
+        when POPWDATABURST =>
+
+          if GetFifoCount(TransRec.WriteBurstFifo) < VPBurstSize then
+            Alert(ModelID, "POPWDATABURST of " & to_string(VPBurstSize) & " bytes with only " &
+                           to_string(GetFifoCount(TransRec.WriteBurstFifo)) & " in the write burst FIFO", ERROR) ;
+          end if ;
+
+          -- Bytes missing from the FIFO are returned as zero
+          for idx in 0 to VPBurstSize-1 loop
+            if Empty(TransRec.WriteBurstFifo) then
+              VSetBurstRdByte(NODE_NUM, idx, 0) ;
+            else
+              VSetBurstRdByte(NODE_NUM, idx, to_integer(unsigned(Pop(TransRec.WriteBurstFifo)))) ;
+            end if ;
+          end loop ;
+
+        when PUSHRDATABURST =>
+
+          for idx in 0 to VPBurstSize-1 loop
+            VGetBurstWrByte(NODE_NUM, idx, VPByte) ;
+            Push(TransRec.ReadBurstFifo, std_logic_vector(to_unsigned(VPByte mod 256, 8))) ;
+          end loop ;
+
         when ACKTRANS =>
 
           if WE then
@@ -463,6 +883,158 @@ begin
 
   end process TransactionDispatcher ;
 
+  ------------------------------------------------------------
+  -- Link utilisation monitor
+  --
+  -- Classifies every transmitted and received symbol time on each
+  -- lane as TLP, DLLP, ordered set, logical idle or electrical idle,
+  -- accumulating counts over the simulation and over windows of
+  -- UtilWindow cycles. TLP and DLLP framing is tracked across the
+  -- lanes in lane order, and ordered sets per lane. Only present
+  -- when enabled with LINK_UTIL_ENABLE or LINK_UTIL_FILE, with
+  -- the counts otherwise reading as 0.
+  ------------------------------------------------------------
+  g_LINKUTIL : if LINK_UTIL_ENABLE or LINK_UTIL_FILE /= "" generate
+    LinkUtilisation : process
+
+      file     UtilFile          : text ;
+      variable L                 : line ;
+
+      variable Count             : UtilCountType(0 to UTIL_NUM_COUNTS-1) := (others => 0) ;
+      variable WinCount          : UtilCountType(0 to UTIL_NUM_COUNTS-1) := (others => 0) ;
+      variable Cycles            : integer                               := 0 ;
+      variable LastRestart       : boolean                               := false ;
+
+      variable InPkt             : integer_vector(0 to 1)                := (others => LINK_UTIL_IDLE) ;
+      variable OsCount           : integer_vector(0 to 2*LINKWIDTH-1)    := (others => 0) ;
+      variable OsFirst           : boolean_vector(0 to 2*LINKWIDTH-1)    := (others => false) ;
+      variable OsSkp             : boolean_vector(0 to 2*LINKWIDTH-1)    := (others => false) ;
+
+      variable Sym               : std_logic_vector (LANEWIDTH-1 downto 0) ;
+      variable KSym              : std_logic_vector (8 downto 0) ;
+      variable IsElecIdle        : boolean ;
+      variable Class             : integer ;
+      variable Lidx              : integer ;
+      variable Cidx              : integer ;
+
+    begin
+
+      if LINK_UTIL_FILE /= "" then
+        file_open(UtilFile, LINK_UTIL_FILE, WRITE_MODE) ;
+
+        write(L, string'("cycle")) ;
+        for dir in 0 to 1 loop
+          for lane in 0 to LINKWIDTH-1 loop
+            for typ in 0 to LINK_UTIL_NUM_TYPES-1 loop
+              write(L, string'(",") & IfElse(dir = LINK_UTIL_TX, "tx", "rx") & to_string(lane) & "_" &
+                       IfElse(typ = LINK_UTIL_TLP,  "tlp",  IfElse(typ = LINK_UTIL_DLLP, "dllp",
+                       IfElse(typ = LINK_UTIL_OS,   "os",   IfElse(typ = LINK_UTIL_IDLE, "idle", "eidle"))))) ;
+            end loop ;
+          end loop ;
+        end loop ;
+        writeline(UtilFile, L) ;
+      end if ;
+
+      loop
+        wait until rising_edge(ClkOut) ;
+
+        if UtilRestart /= LastRestart then
+          LastRestart := UtilRestart ;
+          Count       := (others => 0) ;
+          WinCount    := (others => 0) ;
+          Cycles      := 0 ;
+        end if ;
+
+        for dir in 0 to 1 loop
+          for lane in 0 to LINKWIDTH-1 loop
+
+            Lidx := dir * LINKWIDTH + lane ;
+
+            if dir = LINK_UTIL_TX then
+              Sym        := LinkOutVec(lane) xor InvertOutVec ;
+              IsElecIdle := ElecIdleOut(0) = '1' or is_X(LinkOutVec(lane)) ;
+            else
+              Sym        := LinkInVec(lane) xor InvertInVec ;
+              IsElecIdle := is_X(LinkInVec(lane)) ;
+            end if ;
+
+            KSym := PcieDecodeKSymbol(Sym, PIPE) ;
+
+            if IsElecIdle then
+              Class          := LINK_UTIL_ELEC_IDLE ;
+              OsCount(Lidx)  := 0 ;
+              OsFirst(Lidx)  := false ;
+              OsSkp(Lidx)    := false ;
+
+            -- Ordered sets: COM, then the rest of a TS1/TS2, the SKPs of a SKP OS, or the
+            -- three symbols of an FTS, electrical idle or electrical idle exit OS
+            elsif KSym = SYM_COM then
+              Class          := LINK_UTIL_OS ;
+              OsFirst(Lidx)  := true ;
+              OsSkp(Lidx)    := false ;
+            elsif OsFirst(Lidx) then
+              Class          := LINK_UTIL_OS ;
+              OsFirst(Lidx)  := false ;
+              OsSkp(Lidx)    := KSym = SYM_SKP ;
+              OsCount(Lidx)  := 0  when KSym = SYM_SKP else
+                                2  when KSym = SYM_FTS or KSym = SYM_IDL or KSym = SYM_EIE else
+                                14 ;
+            elsif OsSkp(Lidx) and KSym = SYM_SKP then
+              Class          := LINK_UTIL_OS ;
+            elsif OsCount(Lidx) > 0 then
+              Class          := LINK_UTIL_OS ;
+              OsCount(Lidx)  := OsCount(Lidx) - 1 ;
+
+            -- TLP and DLLP framing, with everything else between packets as logical idle
+            else
+              OsSkp(Lidx)    := false ;
+
+              if KSym = SYM_STP then
+                InPkt(dir)   := LINK_UTIL_TLP ;
+                Class        := LINK_UTIL_TLP ;
+              elsif KSym = SYM_SDP then
+                InPkt(dir)   := LINK_UTIL_DLLP ;
+                Class        := LINK_UTIL_DLLP ;
+              elsif KSym = SYM_END or KSym = SYM_EDB then
+                Class        := InPkt(dir) ;
+                InPkt(dir)   := LINK_UTIL_IDLE ;
+              else
+                Class        := InPkt(dir) ;
+              end if ;
+            end if ;
+
+            Cidx           := Lidx * LINK_UTIL_NUM_TYPES + Class ;
+            Count(Cidx)    := Count(Cidx)    + 1 ;
+            WinCount(Cidx) := WinCount(Cidx) + 1 ;
+
+          end loop ;
+        end loop ;
+
+        Cycles := Cycles + 1 ;
+
+        if UtilWindow > 0 and Cycles >= UtilWindow then
+
+          UtilLast <= WinCount ;
+
+          if LINK_UTIL_FILE /= "" then
+            write(L, ClkCount) ;
+            for idx in WinCount'range loop
+              write(L, string'(",") & to_string(WinCount(idx))) ;
+            end loop ;
+            writeline(UtilFile, L) ;
+          end if ;
+
+          WinCount := (others => 0) ;
+          Cycles   := 0 ;
+        end if ;
+
+        UtilCount <= Count ;
+
+      end loop ;
+
+    end process LinkUtilisation ;
+  end generate ;
+
   ------------------------------------------------------------
   -- Input and output signal conditioning
   ------------------------------------------------------------
@@ -14,6 +14,7 @@
 --
 --  Revision History:
 --    Date      Version    Description
+--    10/2026   2026.10    Added SYMBOL_MODE generic for symbol group serialisation
 --    07/2025   2026.01    Initial version
 --
 --
@@ -61,7 +62,8 @@ entity PcieModelSerial is
     EN_TLP_REQ_DIGEST     : boolean := false ;
     ENABLE_INIT_PHY       : boolean := true  ;
     ENABLE_AUTO           : boolean := false ;
-    GEN2_CLK              : boolean := false
+    GEN2_CLK              : boolean := false ;
+    SYMBOL_MODE           : boolean := false
   );
   port (
     Clk                   : in  std_logic;
@@ -153,10 +155,12 @@ begin
   serdes_i : entity osvvm_pcie.PcieModelSerialiser
   ------------------------------------------------------------
   generic map (
-    NUMOFLANES         => SerLinkOut'length
+    NUMOFLANES         => SerLinkOut'length,
+    SYMBOL_MODE        => SYMBOL_MODE
   )
   port map (
     SerClk             => serclk_main,
+    SymClk             => ClkOut,
 
     ParIn              => PcieLink.LinkOut,
     SerOut             => SerLinkOut,
@@ -11,8 +11,17 @@
 --  Description:
 --      Pcie GEN1/2 model
 --
+--      With SYMBOL_MODE set, each transmitted 10 bit group is scheduled
+--      as a single waveform on the SymClk symbol clock, and received bits
+--      are sampled only on line transitions and SymClk edges, rather than
+--      shifting all lanes on every SerClk edge. The bit period is
+--      seeded from the first two SerClk edges, so that the first symbol
+--      clocked is not lost, and then tracks the SymClk period.
+--
 --  Revision History:
 --    Date      Version    Description
+--    10/2026   2026.10    Seed symbol mode bit period from SerClk
+--    10/2026   2026.10    Added symbol group serialisation mode
 --    07/2025   2026.01    Initial version
 --
 --
@@ -45,10 +54,12 @@ library osvvm_common ;
 
 entity PcieModelSerialiser is
   generic (
-    NUMOFLANES                         : integer := MAXLINKWIDTH
+    NUMOFLANES                         : integer := MAXLINKWIDTH ;
+    SYMBOL_MODE                        : boolean := false
   );
   port (
     SerClk                             : in  std_logic;
+    SymClk                             : in  std_logic := '0';
 
     ParIn                              : in  LinkType(0 to NUMOFLANES-1)(ENCODEDWIDTH-1 downto 0) ;
     SerOut                             : out std_logic_vector (NUMOFLANES-1 downto 0);
@@ -69,60 +80,193 @@ signal Synced                          : std_logic := '0';
 signal SerialCount                     : integer   := 0;
 signal DeserialCount                   : integer   := 0;
 
+signal SerBitPeriod                    : time      := 0 ns;
+
 begin
 
+  g_BITMODE : if not SYMBOL_MODE generate
 
-  g_GENDATA:  for i in 0 to NUMOFLANES-1 generate
-    ParOut(i)           <= (others => 'Z') when Synced = '0' else  DeserialReg(i);
-    SerOut(i)           <= SerialShift(i)(0);
-  end generate g_GENDATA;
+    g_GENDATA:  for i in 0 to NUMOFLANES-1 generate
+      ParOut(i)           <= (others => 'Z') when Synced = '0' else  DeserialReg(i);
+      SerOut(i)           <= SerialShift(i)(0);
+    end generate g_GENDATA;
 
-  process (SerClk)
-  begin
-    if SerClk'event and SerClk = '1' then
+    process (SerClk)
+    begin
+      if SerClk'event and SerClk = '1' then
+
+        if SerialCount = 0 then
+          SerialCount <= ENCODEDWIDTH-1;
+          for idx in 0 to NUMOFLANES-1 loop
+            if not is_X(ParIn(idx)) then
+              SerialShift(idx) <= ParIn(idx);
+            end if;
+          end loop;
+        else
+          SerialCount <=  SerialCount - 1;
+          for idx in 0 to NUMOFLANES-1 loop
+            SerialShift(idx) <= '0' &  SerialShift(idx)(ENCODEDWIDTH-1 downto 1);
+          end loop;
+        end if;
 
-      if SerialCount = 0 then
-        SerialCount <= ENCODEDWIDTH-1;
         for idx in 0 to NUMOFLANES-1 loop
-          if not is_X(ParIn(idx)) then
-            SerialShift(idx) <= ParIn(idx);
+          if SerIn(idx) = '1' or SerIn(idx) = '0' then
+            DeserialShift(idx) <= SerIn(idx) & DeserialShift(idx)(ENCODEDWIDTH-1 downto 1);
           end if;
         end loop;
-      else
-        SerialCount <=  SerialCount - 1;
-        for idx in 0 to NUMOFLANES-1 loop
-          SerialShift(idx) <= '0' &  SerialShift(idx)(ENCODEDWIDTH-1 downto 1);
-        end loop;
-      end if;
 
-      for idx in 0 to NUMOFLANES-1 loop
-        if SerIn(idx) = '1' or SerIn(idx) = '0' then
-          DeserialShift(idx) <= SerIn(idx) & DeserialShift(idx)(ENCODEDWIDTH-1 downto 1);
+        -- Maintain sync
+        if Synced = '1' then
+          if SerIn(0) = 'Z' or SerIn(0) = 'X' then
+            Synced <= '0';
+          end if;
+        else
+          if DeserialShift(0) = NCOMMA or DeserialShift(0) = PCOMMA then
+            Synced <= '1';
+          end if;
         end if;
-      end loop;
 
-      -- Maintain sync
-      if Synced = '1' then
-        if SerIn(0) = 'Z' or SerIn(0) = 'X' then
-          Synced <= '0';
+        if Synced = '1' then
+          DeserialCount <=  (DeserialCount + 1) mod ENCODEDWIDTH;
         end if;
-      else
-        if DeserialShift(0) = NCOMMA or DeserialShift(0) = PCOMMA then
-          Synced <= '1';
+
+        if DeserialCount = (ENCODEDWIDTH-1) or (Synced = '0' and (DeserialShift(0) = NCOMMA or DeserialShift(0) = PCOMMA)) then
+          for idx in 0 to NUMOFLANES-1 loop
+            DeserialReg(idx) <= DeserialShift(idx);
+          end loop;
         end if;
       end if;
 
-      if Synced = '1' then
-        DeserialCount <=  (DeserialCount + 1) mod ENCODEDWIDTH;
-      end if;
+    end process;
 
-      if DeserialCount = (ENCODEDWIDTH-1) or (Synced = '0' and (DeserialShift(0) = NCOMMA or DeserialShift(0) = PCOMMA)) then
-        for idx in 0 to NUMOFLANES-1 loop
-          DeserialReg(idx) <= DeserialShift(idx);
-        end loop;
-      end if;
-    end if;
+  else generate
+
+    ------------------------------------------------------------
+    -- Measure the bit period from the first two SerClk edges,
+    -- for use until a symbol clock period has been seen
+    ------------------------------------------------------------
+    SerBitMeasure : process
+      variable FirstEdge : time ;
+    begin
+      wait until rising_edge(SerClk) ;
+      FirstEdge := now ;
+      wait until rising_edge(SerClk) ;
+      SerBitPeriod <= now - FirstEdge ;
+      wait ;
+    end process SerBitMeasure ;
+
+    ------------------------------------------------------------
+    -- Transmit a symbol per lane on each symbol clock, as one
+    -- waveform with the bit period measured from the clock
+    ------------------------------------------------------------
+    SymbolTx : process
+      variable LastEdge  : time    := 0 ns ;
+      variable EdgeSeen  : boolean := false ;
+      variable BitPeriod : time    := 0 ns ;
+      variable Sym       : std_logic_vector (ENCODEDWIDTH-1 downto 0) ;
+    begin
+      SerOut <= (others => '0') ;
+
+      loop
+        wait until rising_edge(SymClk) ;
+
+        if EdgeSeen then
+          BitPeriod := (now - LastEdge) / ENCODEDWIDTH ;
+        else
+          BitPeriod := SerBitPeriod ;
+        end if ;
+
+        EdgeSeen := true ;
+        LastEdge := now ;
+
+        if BitPeriod > 0 ns then
+          for idx in 0 to NUMOFLANES-1 loop
+            Sym := ParIn(idx) when not is_X(ParIn(idx)) else (others => '0') ;
+
+            for bidx in 0 to ENCODEDWIDTH-1 loop
+              SerOut(idx) <= transport Sym(bidx) after bidx * BitPeriod ;
+            end loop ;
+          end loop ;
+        end if ;
+      end loop ;
+    end process SymbolTx ;
+
+    ------------------------------------------------------------
+    -- Sample received bits at the bit centres that have passed
+    -- on each line transition or symbol clock edge, with lane 0
+    -- transitions realigning the sample phase. Symbols are
+    -- output one symbol period after their last bit, keeping
+    -- each on ParOut for a symbol period.
+    ------------------------------------------------------------
+    SymbolRx : process (SerIn, SymClk)
+      variable Started    : boolean := false ;
+      variable Level      : std_logic_vector (NUMOFLANES-1 downto 0) := (others => 'Z') ;
+      variable Shift      : LinkType(0 to NUMOFLANES-1)(ENCODEDWIDTH-1 downto 0) := (others => (others => '0')) ;
+      variable InSync     : boolean := false ;
+      variable BitIdx     : integer := 0 ;
+      variable LastEdge   : time    := 0 ns ;
+      variable EdgeSeen   : boolean := false ;
+      variable BitPeriod  : time    := 0 ns ;
+      variable NextSample : time    := 0 ns ;
+      variable Latency    : time ;
+    begin
+
+      if not Started then
+        ParOut  <= (others => (others => 'Z')) ;
+        Started := true ;
+      end if ;
+
+      if rising_edge(SymClk) then
+        if EdgeSeen then
+          BitPeriod := (now - LastEdge) / ENCODEDWIDTH ;
+        else
+          BitPeriod := SerBitPeriod ;
+        end if ;
+
+        EdgeSeen := true ;
+        LastEdge := now ;
+      end if ;
+
+      if BitPeriod = 0 ns then
+        NextSample := now ;
+      else
+        while NextSample < now loop
+
+          for idx in 0 to NUMOFLANES-1 loop
+            if Level(idx) = '1' or Level(idx) = '0' then
+              Shift(idx) := Level(idx) & Shift(idx)(ENCODEDWIDTH-1 downto 1) ;
+            end if ;
+          end loop ;
+
+          Latency := NextSample + ENCODEDWIDTH * BitPeriod - now ;
+          BitIdx  := BitIdx + 1 ;
+
+          -- Maintain sync
+          if InSync and Level(0) /= '1' and Level(0) /= '0' then
+            InSync := false ;
+            for idx in 0 to NUMOFLANES-1 loop
+              ParOut(idx) <= transport (others => 'Z') after Latency ;
+            end loop ;
+          elsif (InSync and BitIdx = ENCODEDWIDTH) or (not InSync and (Shift(0) = NCOMMA or Shift(0) = PCOMMA)) then
+            InSync := true ;
+            BitIdx := 0 ;
+            for idx in 0 to NUMOFLANES-1 loop
+              ParOut(idx) <= transport Shift(idx) after Latency ;
+            end loop ;
+          end if ;
+
+          NextSample := NextSample + BitPeriod ;
+        end loop ;
+
+        if SerIn(0)'event then
+          NextSample := now + BitPeriod / 2 ;
+        end if ;
+      end if ;
+
+      Level := SerIn ;
+
+    end process SymbolRx ;
 
-  end process;
+  end generate g_BITMODE ;
 
 end behavioural;
\ No newline at end of file
@@ -0,0 +1,159 @@
+--
+--  File Name:         PcieModelTlpStream.vhd
+--  Design Unit Name:  PcieModelTlpStream
+--  Revision:          OSVVM MODELS STANDARD VERSION
+--
+--  Maintainer:        Simon Southwell      email:  simon.southwell@gmail.com
+--  Contributor(s):
+--     Simon Southwell      simon.southwell@gmail.com
+--
+--
+--  Description:
+--      Pcie GEN1/2 model wrapper module presenting a TLP valid/ready
+--      stream interface, for connecting to DUTs that sit behind a hard
+--      IP's TLP streaming interface. The model is configured for PIPE
+--      with no scrambling and no link training, and the PHY and DLL
+--      framing is terminated in PcieTlpStreamAdapter. The internal link
+--      width defaults to x1 so that only a single lane is exchanged with
+--      the C model each cycle.
+--
+--  Revision History:
+--    Date      Version    Description
+--    10/2026   2026.10    Initial version
+--
+--
+--  This file is part of OSVVM.
+--
+--  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md).
+--
+--  Licensed under the Apache License, Version 2.0 (the "License") ;
+--  you may not use this file except in compliance with the License.
+--  You may obtain a copy of the License at
+--
+--      https://www.apache.org/licenses/LICENSE-2.0
+--
+--  Unless required by applicable law or agreed to in writing, software
+--  distributed under the License is distributed on an "AS IS" BASIS,
+--  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+--  See the License for the specific language governing permissions and
+--  limitations under the License.
+--
+library ieee ;
+  use ieee.std_logic_1164.all ;
+  use ieee.numeric_std.all ;
+  use ieee.numeric_std_unsigned.all ;
+
+library osvvm_common ;
+  context osvvm_common.OsvvmCommonContext ;
+
+library osvvm_pcie ;
+  context osvvm_pcie.PcieContext ;
+
+-- -------------------------------------------------------------
+--  PcieModelTlpStream
+-- -------------------------------------------------------------
+
+entity PcieModelTlpStream is
+
+  generic (
+    MODEL_ID_NAME         : string  := "" ;
+    NODE_NUM              : integer := 8 ;
+    ENDPOINT              : boolean := false ;
+    REQ_ID                : integer := 0 ;
+    EN_TLP_REQ_DIGEST     : boolean := false ;
+    ENABLE_AUTO           : boolean := false ;
+    LINKWIDTH             : integer := 1         -- internal model to adapter link width
+  );
+  port (
+    Clk                   : in  std_logic;
+    nReset                : in  std_logic;
+
+    -- Test bench Transaction Interface
+    TransRec              : inout AddressBusRecType ;
+
+    -- TLP stream output (model to DUT)
+    TlpOutData            : out std_logic_vector (31 downto 0) ;
+    TlpOutSop             : out std_logic ;
+    TlpOutEop             : out std_logic ;
+    TlpOutValid           : out std_logic ;
+    TlpOutReady           : in  std_logic ;
+
+    -- TLP stream input (DUT to model)
+    TlpInData             : in  std_logic_vector (31 downto 0) ;
+    TlpInSop              : in  std_logic ;
+    TlpInEop              : in  std_logic ;
+    TlpInValid            : in  std_logic ;
+    TlpInReady            : out std_logic
+  );
+
+end entity PcieModelTlpStream;
+
+architecture behavioural of PcieModelTlpStream is
+
+signal PcieLink : PcieRecType(
+    LinkOut (0 to LINKWIDTH-1)(PIPEWIDTH-1 downto 0),
+    LinkIn  (0 to LINKWIDTH-1)(PIPEWIDTH-1 downto 0)
+  ) ;
+
+signal ClkOut             : std_logic ;
+
+begin
+
+  ------------------------------------------------------------
+  pciemodel_i : entity osvvm_pcie.PcieModel
+  ------------------------------------------------------------
+  generic map (
+    MODEL_ID_NAME      => MODEL_ID_NAME,
+    NODE_NUM           => NODE_NUM,
+    ENDPOINT           => ENDPOINT,
+    REQ_ID             => REQ_ID,
+    EN_TLP_REQ_DIGEST  => EN_TLP_REQ_DIGEST,
+    PIPE               => true,
+    DISABLE_SCRAMBLING => true,
+    ENABLE_INIT_PHY    => false,
+    ENABLE_AUTO        => ENABLE_AUTO
+  )
+  port map (
+    -- Globals
+    Clk                => Clk,
+    nReset             => nReset,
+
+    ClkOut             => ClkOut,
+    Gen2ClkSel         => open,
+
+    -- Test bench Transaction Interface
+    TransRec           => TransRec,
+
+    -- PCIe Functional Interface
+    PcieLinkOut        => PcieLink.LinkOut,
+    PcieLinkIn         => PcieLink.LinkIn
+  ) ;
+
+  ------------------------------------------------------------
+  adapter_i : entity osvvm_pcie.PcieTlpStreamAdapter
+  ------------------------------------------------------------
+  generic map (
+    MODEL_ID_NAME      => MODEL_ID_NAME & "_TlpStream",
+    NUMOFLANES         => LINKWIDTH
+  )
+  port map (
+    Clk                => ClkOut,
+    nReset             => nReset,
+
+    LinkFromModel      => PcieLink.LinkOut,
+    LinkToModel        => PcieLink.LinkIn,
+
+    TlpOutData         => TlpOutData,
+    TlpOutSop          => TlpOutSop,
+    TlpOutEop          => TlpOutEop,
+    TlpOutValid        => TlpOutValid,
+    TlpOutReady        => TlpOutReady,
+
+    TlpInData          => TlpInData,
+    TlpInSop           => TlpInSop,
+    TlpInEop           => TlpInEop,
+    TlpInValid         => TlpInValid,
+    TlpInReady         => TlpInReady
+  );
+
+end behavioural;
@@ -0,0 +1,623 @@
+--
+--  File Name:         PcieTlpStreamAdapter.vhd
+--  Design Unit Name:  PcieTlpStreamAdapter
+--  Revision:          OSVVM MODELS STANDARD VERSION
+--
+--  Maintainer:        Simon Southwell      email:  simon.southwell@gmail.com
+--  Contributor(s):
+--     Simon Southwell      simon.southwell@gmail.com
+--
+--
+--  Description:
+--      Adapter between the PIPE (unscrambled) lanes of the PCIe model and a
+--      TLP valid/ready stream interface, standing in for the PHY and data
+--      link layers of a hard IP. TLPs from the model have their framing,
+--      sequence number and LCRC stripped and are output as DWORDs. TLPs
+--      input on the stream are framed, sequence numbered and LCRC'd before
+--      being sent to the model. The adapter does flow control initialisation
+--      and acknowledges all good TLPs from the model. The credits advertised
+--      to the model are sized to the output stream FIFO, and returned with
+--      UpdateFC DLLPs as each TLP is drained from the stream, so that a DUT
+--      holding off TlpOutReady throttles the model.
+--
+--      Stream DWORDs are in TLP byte order, with byte 0 of each DWORD in
+--      bits 31:24 (i.e. header DWORDs as shown in the specification).
+--
+--  Revision History:
+--    Date      Version    Description
+--    10/2026   2026.10    Table driven CRCs for packet preparation
+--    10/2026   2026.10    Receive lanes scanned by cycle for framing symbols
+--    10/2026   2026.10    Initial version
+--
+--
+--  This file is part of OSVVM.
+--
+--  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md).
+--
+--  Licensed under the Apache License, Version 2.0 (the "License") ;
+--  you may not use this file except in compliance with the License.
+--  You may obtain a copy of the License at
+--
+--      https://www.apache.org/licenses/LICENSE-2.0
+--
+--  Unless required by applicable law or agreed to in writing, software
+--  distributed under the License is distributed on an "AS IS" BASIS,
+--  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+--  See the License for the specific language governing permissions and
+--  limitations under the License.
+--
+
+library ieee ;
+  use ieee.std_logic_1164.all ;
+  use ieee.numeric_std.all ;
+  use ieee.numeric_std_unsigned.all ;
+
+library osvvm ;
+  context osvvm.OsvvmContext ;
+
+library osvvm_common ;
+  context osvvm_common.OsvvmCommonContext ;
+
+  use work.PcieInterfacePkg.all ;
+
+entity PcieTlpStreamAdapter is
+  generic (
+    MODEL_ID_NAME      : string  := "" ;
+    NUMOFLANES         : integer := 1
+  );
+  port (
+    Clk                : in  std_logic ;
+    nReset             : in  std_logic ;
+
+    -- PIPE lanes to/from the PCIe model
+    LinkFromModel      : in  LinkType(0 to NUMOFLANES-1)(PIPEWIDTH-1 downto 0) ;
+    LinkToModel        : out LinkType(0 to NUMOFLANES-1)(PIPEWIDTH-1 downto 0) ;
+
+    -- TLP stream output (model to DUT)
+    TlpOutData         : out std_logic_vector (31 downto 0) ;
+    TlpOutSop          : out std_logic ;
+    TlpOutEop          : out std_logic ;
+    TlpOutValid        : out std_logic ;
+    TlpOutReady        : in  std_logic ;
+
+    -- TLP stream input (DUT to model)
+    TlpInData          : in  std_logic_vector (31 downto 0) ;
+    TlpInSop           : in  std_logic ;
+    TlpInEop           : in  std_logic ;
+    TlpInValid         : in  std_logic ;
+    TlpInReady         : out std_logic
+  );
+
+  -- Derive ModelInstance label from path_name
+  constant MODEL_INSTANCE_NAME : string :=
+    IfElse(MODEL_ID_NAME /= "", MODEL_ID_NAME, PathTail(to_lower(PcieTlpStreamAdapter'PATH_NAME))) ;
+
+end entity PcieTlpStreamAdapter ;
+
+architecture behavioural of PcieTlpStreamAdapter is
+
+  -- PIPE symbols (bit 8 is the K flag)
+  constant SYM_STP           : std_logic_vector (8 downto 0) := 9x"1FB" ;  -- K27.7
+  constant SYM_SDP           : std_logic_vector (8 downto 0) := 9x"15C" ;  -- K28.2
+  constant SYM_END           : std_logic_vector (8 downto 0) := 9x"1FD" ;  -- K29.7
+  constant SYM_PAD           : std_logic_vector (8 downto 0) := 9x"1F7" ;  -- K23.7
+  constant SYM_IDLE          : std_logic_vector (8 downto 0) := 9x"000" ;  -- D0.0 logical idle
+
+  constant DLLP_ACK          : std_logic_vector (7 downto 0) := 8x"00" ;
+  constant DLLP_NAK          : std_logic_vector (7 downto 0) := 8x"10" ;
+
+  -- Maximum sequence number + TLP + LCRC bytes
+  constant MAXPKTBYTES       : integer := 4096 + 32 ;
+  constant MAXTXSYMBOLS      : integer := MAXPKTBYTES + 2*MAXLINKWIDTH ;
+  constant OUTFIFODEPTH      : integer := 8192 ;
+
+  -- Credits advertised for each of P, NP and Cpl. With up to 5 header and
+  -- digest DWORDs per header credit and 4 DWORDs per data credit, the TLPs
+  -- of all three types fit in the output FIFO together.
+  constant FC_HDR_CREDITS    : integer := 32 ;
+  constant FC_DATA_CREDITS   : integer := 512 ;
+  constant MAXFIFOTLPS       : integer := 3 * FC_HDR_CREDITS ;
+
+  constant FC_POSTED         : integer := 0 ;
+  constant FC_NONPOSTED      : integer := 1 ;
+  constant FC_COMPLETION     : integer := 2 ;
+
+  constant DLLP_INITFC1      : std_logic_vector (7 downto 0) := 8x"40" ;
+  constant DLLP_INITFC2      : std_logic_vector (7 downto 0) := 8x"C0" ;
+  constant DLLP_UPDATEFC     : std_logic_vector (7 downto 0) := 8x"80" ;
+
+  type ByteArrayType   is array (natural range <>) of std_logic_vector (7 downto 0) ;
+  type SymbolArrayType is array (natural range <>) of std_logic_vector (8 downto 0) ;
+  type OutFifoType     is array (natural range <>) of std_logic_vector (33 downto 0) ;
+  type CrcTableType    is array (natural range <>) of std_logic_vector ;
+  type IntArrayType    is array (natural range <>) of integer ;
+  type RxStateType     is (RX_IDLE, RX_TLP, RX_DLLP) ;
+
+  signal   ModelID           : AlertLogIDType ;
+  signal   TlpInReadyInt     : std_logic := '0' ;
+  signal   TlpOutValidInt    : std_logic := '0' ;
+
+  ------------------------------------------------------------
+  function CrcTable (
+  -- Build a byte at a time CRC update table for a polynomial
+  ------------------------------------------------------------
+    Poly                     : std_logic_vector
+  ) return CrcTableType is
+    variable Table           : CrcTableType (0 to 255)(Poly'length-1 downto 0) ;
+    variable C               : std_logic_vector (Poly'length-1 downto 0) ;
+    variable FeedBack        : std_logic ;
+  begin
+    for Idx in 0 to 255 loop
+      C                          := (others => '0') ;
+      C(C'high downto C'high-7)  := std_logic_vector(to_unsigned(Idx, 8)) ;
+      for BitIdx in 0 to 7 loop
+        FeedBack := C(C'high) ;
+        C        := C(C'high-1 downto 0) & '0' ;
+        if FeedBack = '1' then
+          C := C xor Poly ;
+        end if ;
+      end loop ;
+      Table(Idx) := C ;
+    end loop ;
+    return Table ;
+  end function CrcTable ;
+
+  constant LCRC_TABLE        : CrcTableType (0 to 255)(31 downto 0) := CrcTable(32x"04C11DB7") ;
+  constant DLLP_CRC_TABLE    : CrcTableType (0 to 255)(15 downto 0) := CrcTable(16x"100B") ;
+
+  ------------------------------------------------------------
+  function CrcByte (
+  -- Update CRC with a byte, processing bit 0 first, with a
+  -- single lookup in a table from CrcTable
+  ------------------------------------------------------------
+    Crc                      : std_logic_vector ;
+    Byte                     : std_logic_vector (7 downto 0) ;
+    Table                    : CrcTableType
+  ) return std_logic_vector is
+    variable C               : std_logic_vector (Crc'length-1 downto 0) := Crc ;
+    variable ByteRev         : std_logic_vector (7 downto 0) ;
+  begin
+    for BitIdx in 0 to 7 loop
+      ByteRev(7-BitIdx) := Byte(BitIdx) ;
+    end loop ;
+    return (C(C'high-8 downto 0) & 8x"00") xor Table(to_integer(unsigned(C(C'high downto C'high-7) xor ByteRev))) ;
+  end function CrcByte ;
+
+  ------------------------------------------------------------
+  function FcTypeOf (
+  -- Flow control type of a TLP from its first header byte
+  ------------------------------------------------------------
+    Hdr0                     : std_logic_vector (7 downto 0)
+  ) return integer is
+  begin
+    if Hdr0(4 downto 3) = "10" then
+      return FC_POSTED ;                             -- Msg/MsgD
+    elsif Hdr0(4 downto 1) = "0101" then
+      return FC_COMPLETION ;                         -- Cpl/CplD/CplLk/CplDLk
+    elsif Hdr0(6) = '1' and Hdr0(4 downto 0) = "00000" then
+      return FC_POSTED ;                             -- MWr
+    else
+      return FC_NONPOSTED ;
+    end if ;
+  end function FcTypeOf ;
+
+  ------------------------------------------------------------
+  function CrcOutByte (
+  -- Bit reverse and invert a CRC byte for transmission
+  ------------------------------------------------------------
+    Byte                     : std_logic_vector (7 downto 0)
+  ) return std_logic_vector is
+    variable Result          : std_logic_vector (7 downto 0) ;
+  begin
+    for BitIdx in 0 to 7 loop
+      Result(BitIdx) := not Byte(7-BitIdx) ;
+    end loop ;
+    return Result ;
+  end function CrcOutByte ;
+
+begin
+
+  TlpInReady  <= TlpInReadyInt ;
+  TlpOutValid <= TlpOutValidInt ;
+
+  ------------------------------------------------------------
+  Initialise : process
+  ------------------------------------------------------------
+  begin
+    ModelID <= NewID(MODEL_INSTANCE_NAME) ;
+    wait ;
+  end process Initialise ;
+
+  ------------------------------------------------------------
+  --  Link and stream processing
+  ------------------------------------------------------------
+  StreamAdapter : process (Clk)
+
+    -- Receive (model to stream) state
+    variable RxState         : RxStateType := RX_IDLE ;
+    variable RxBuf           : ByteArrayType (0 to MAXPKTBYTES-1) ;
+    variable RxLen           : integer := 0 ;
+    variable RxLcrc          : std_logic_vector (31 downto 0) ;
+    variable Sym             : std_logic_vector (8 downto 0) ;
+    variable KMask           : std_logic_vector (NUMOFLANES-1 downto 0) ;
+    variable XMask           : std_logic_vector (NUMOFLANES-1 downto 0) ;
+
+    -- Outgoing stream FIFO (bit 33 = SOP, bit 32 = EOP)
+    variable OutFifo         : OutFifoType (0 to OUTFIFODEPTH-1) ;
+    variable OutWr           : integer := 0 ;
+    variable OutRd           : integer := 0 ;
+    variable OutCount        : integer := 0 ;
+
+    -- Flow control type and data credits of each TLP in the output FIFO
+    variable TlpFcType       : IntArrayType (0 to MAXFIFOTLPS-1) ;
+    variable TlpFcData       : IntArrayType (0 to MAXFIFOTLPS-1) ;
+    variable TlpWr           : integer := 0 ;
+    variable TlpRd           : integer := 0 ;
+    variable TlpCount        : integer := 0 ;
+    variable FcType          : integer ;
+    variable FcData          : integer ;
+
+    -- Credits allocated to the model (modulo the field widths), and
+    -- UpdateFCs due, for P, NP and Cpl
+    variable FcAllocHdr      : IntArrayType (0 to 2) := (others => FC_HDR_CREDITS) ;
+    variable FcAllocData     : IntArrayType (0 to 2) := (others => FC_DATA_CREDITS) ;
+    variable FcUpdate        : boolean_vector (0 to 2) := (others => false) ;
+
+    -- Data link layer state
+    variable AckPending      : boolean := false ;
+    variable NakPending      : boolean := false ;
+    variable AckSeq          : std_logic_vector (11 downto 0) := (others => '1') ;
+    variable TxSeq           : std_logic_vector (11 downto 0) := (others => '0') ;
+    variable FcInit2Seen     : boolean := false ;
+    variable FcInitCount     : integer := 0 ;
+
+    -- Incoming stream TLP buffer
+    variable InBuf           : ByteArrayType (0 to MAXPKTBYTES-1) ;
+    variable InLen           : integer := 0 ;
+    variable InTlpRdy        : boolean := false ;
+
+    -- Transmit (to model) symbol queue
+    variable TxBuf           : SymbolArrayType (0 to MAXTXSYMBOLS-1) ;
+    variable TxLen           : integer := 0 ;
+    variable TxIdx           : integer := 0 ;
+    variable Crc             : std_logic_vector (31 downto 0) ;
+    variable Crc16           : std_logic_vector (15 downto 0) ;
+    variable Dllp            : ByteArrayType (0 to 3) ;
+
+    ----------------------------------------
+    procedure QueueSymbol (S : std_logic_vector (8 downto 0)) is
+    ----------------------------------------
+    begin
+      TxBuf(TxLen) := S ;
+      TxLen        := TxLen + 1 ;
+    end procedure QueueSymbol ;
+
+    ----------------------------------------
+    procedure QueueDllp is
+    -- Frame the DLLP in Dllp with SDP/END and its CRC
+    ----------------------------------------
+    begin
+      Crc16 := (others => '1') ;
+      QueueSymbol(SYM_SDP) ;
+      for idx in 0 to 3 loop
+        Crc16 := CrcByte(Crc16, Dllp(idx), DLLP_CRC_TABLE) ;
+        QueueSymbol('0' & Dllp(idx)) ;
+      end loop ;
+      QueueSymbol('0' & CrcOutByte(Crc16(15 downto 8))) ;
+      QueueSymbol('0' & CrcOutByte(Crc16( 7 downto 0))) ;
+      QueueSymbol(SYM_END) ;
+    end procedure QueueDllp ;
+
+    ----------------------------------------
+    procedure QueueFc (DllpType : std_logic_vector (7 downto 0) ; Typ : integer) is
+    -- Queue an InitFC or UpdateFC DLLP for VC0 with the credits
+    -- allocated for a type
+    ----------------------------------------
+      variable Hdr  : std_logic_vector (7 downto 0)  := to_slv(FcAllocHdr(Typ), 8) ;
+      variable Data : std_logic_vector (11 downto 0) := to_slv(FcAllocData(Typ), 12) ;
+    begin
+      Dllp(0) := DllpType or ("00" & to_slv(Typ, 2) & "0000") ;
+      Dllp(1) := "00" & Hdr(7 downto 2) ;
+      Dllp(2) := Hdr(1 downto 0) & "00" & Data(11 downto 8) ;
+      Dllp(3) := Data(7 downto 0) ;
+      QueueDllp ;
+    end procedure QueueFc ;
+
+    ----------------------------------------
+    procedure QueueInitFc (Init2 : boolean) is
+    -- Queue InitFC DLLPs for P, NP and Cpl
+    ----------------------------------------
+    begin
+      for Typ in 0 to 2 loop
+        if Init2 then
+          QueueFc(DLLP_INITFC2, Typ) ;
+        else
+          QueueFc(DLLP_INITFC1, Typ) ;
+        end if ;
+      end loop ;
+    end procedure QueueInitFc ;
+
+    ----------------------------------------
+    procedure ProcessRxTlp is
+    -- Check a received TLP and send to the output stream
+    ----------------------------------------
+      variable Offset : integer ;
+      variable Sop    : std_logic ;
+      variable Eop    : std_logic ;
+    begin
+      if RxLen < 18 or ((RxLen - 6) mod 4) /= 0 then
+        Alert(ModelID, "Malformed TLP of " & to_string(RxLen) & " bytes received from model", ERROR) ;
+        NakPending := true ;
+        return ;
+      end if ;
+
+      RxLcrc := (others => '1') ;
+      for idx in 0 to RxLen-5 loop
+        RxLcrc := CrcByte(RxLcrc, RxBuf(idx), LCRC_TABLE) ;
+      end loop ;
+
+      for idx in 0 to 3 loop
+        if CrcOutByte(RxLcrc(31-8*idx downto 24-8*idx)) /= RxBuf(RxLen-4+idx) then
+          Alert(ModelID, "Bad LCRC on TLP received from model", ERROR) ;
+          NakPending := true ;
+          return ;
+        end if ;
+      end loop ;
+
+      -- Only possible if the model exceeds the advertised credits
+      if OutCount + (RxLen-6)/4 > OUTFIFODEPTH or TlpCount >= MAXFIFOTLPS then
+        Alert(ModelID, "TLP output stream FIFO overflow", FAILURE) ;
+        return ;
+      end if ;
+
+      -- Hold the credits the TLP consumes until it leaves the stream
+      FcData := 0 ;
+      if RxBuf(2)(6) = '1' then
+        FcData := to_integer(unsigned(RxBuf(4)(1 downto 0) & RxBuf(5))) ;
+        FcData := 1024 when FcData = 0 else FcData ;
+        FcData := (FcData + 3) / 4 ;
+      end if ;
+      TlpFcType(TlpWr) := FcTypeOf(RxBuf(2)) ;
+      TlpFcData(TlpWr) := FcData ;
+      TlpWr            := (TlpWr + 1) mod MAXFIFOTLPS ;
+      TlpCount         := TlpCount + 1 ;
+
+      Offset := 2 ;
+      while Offset < RxLen-4 loop
+        Sop            := '1' when Offset = 2       else '0' ;
+        Eop            := '1' when Offset = RxLen-8 else '0' ;
+        OutFifo(OutWr) := Sop & Eop & RxBuf(Offset) & RxBuf(Offset+1) & RxBuf(Offset+2) & RxBuf(Offset+3) ;
+        OutWr          := (OutWr + 1) mod OUTFIFODEPTH ;
+        OutCount       := OutCount + 1 ;
+        Offset         := Offset + 4 ;
+      end loop ;
+
+      AckSeq      := RxBuf(0)(3 downto 0) & RxBuf(1) ;
+      AckPending  := true ;
+      FcInit2Seen := true ;
+    end procedure ProcessRxTlp ;
+
+    ----------------------------------------
+    procedure ProcessRxDllp is
+    -- Note the end of flow control initialisation from the model
+    ----------------------------------------
+    begin
+      if RxLen /= 6 then
+        Alert(ModelID, "Malformed DLLP received from model", ERROR) ;
+      elsif RxBuf(0)(7 downto 6) = "11" or RxBuf(0)(7 downto 6) = "10" then
+        -- InitFC2 or UpdateFC
+        FcInit2Seen := true ;
+      elsif RxBuf(0) = DLLP_NAK then
+        Alert(ModelID, "NAK received from model for a streamed TLP (no replay supported)", WARNING) ;
+      end if ;
+    end procedure ProcessRxDllp ;
+
+  begin
+    if Clk'event and Clk = '1' then
+
+      if nReset = '0' then
+
+        RxState        := RX_IDLE ;
+        OutWr          := 0 ;
+        OutRd          := 0 ;
+        OutCount       := 0 ;
+        TlpWr          := 0 ;
+        TlpRd          := 0 ;
+        TlpCount       := 0 ;
+        FcAllocHdr     := (others => FC_HDR_CREDITS) ;
+        FcAllocData    := (others => FC_DATA_CREDITS) ;
+        FcUpdate       := (others => false) ;
+        AckPending     := false ;
+        NakPending     := false ;
+        FcInit2Seen    := false ;
+        FcInitCount    := 0 ;
+        InLen          := 0 ;
+        InTlpRdy       := false ;
+        TxLen          := 0 ;
+        TxIdx          := 0 ;
+        TxSeq          := (others => '0') ;
+        AckSeq         := (others => '1') ;
+        TlpOutValidInt <= '0' ;
+        TlpInReadyInt  <= '0' ;
+        LinkToModel    <= (others => SYM_IDLE) ;
+
+      else
+
+        -- ---------------------------------------------------
+        -- Receive lane symbols from the model in striped order.
+        -- The cycle's lanes are gathered into control and invalid
+        -- symbol masks first, so that cycles with no framing
+        -- symbols are skipped when idle or appended to the packet
+        -- as a block, with only framing cycles scanned by symbol.
+        -- ---------------------------------------------------
+        for lane in 0 to NUMOFLANES-1 loop
+          KMask(lane) := LinkFromModel(lane)(8) ;
+          XMask(lane) := '1' when is_X(LinkFromModel(lane)) else '0' ;
+        end loop ;
+
+        if (or (KMask or XMask)) = '0' and (RxState = RX_IDLE or RxLen + NUMOFLANES <= MAXPKTBYTES) then
+
+          if RxState /= RX_IDLE then
+            for lane in 0 to NUMOFLANES-1 loop
+              RxBuf(RxLen + lane) := LinkFromModel(lane)(7 downto 0) ;
+            end loop ;
+            RxLen := RxLen + NUMOFLANES ;
+          end if ;
+
+        else
+
+          for lane in 0 to NUMOFLANES-1 loop
+            Sym := LinkFromModel(lane) ;
+
+            if is_X(Sym) then
+              RxState := RX_IDLE ;
+            else
+              case RxState is
+              when RX_IDLE =>
+                if Sym = SYM_STP then
+                  RxState := RX_TLP ;
+                  RxLen   := 0 ;
+                elsif Sym = SYM_SDP then
+                  RxState := RX_DLLP ;
+                  RxLen   := 0 ;
+                end if ;
+
+              when RX_TLP | RX_DLLP =>
+                if Sym(8) = '1' then
+                  if Sym = SYM_END then
+                    if RxState = RX_TLP then
+                      ProcessRxTlp ;
+                    else
+                      ProcessRxDllp ;
+                    end if ;
+                  end if ;
+                  RxState := RX_IDLE ;
+                elsif RxLen < MAXPKTBYTES then
+                  RxBuf(RxLen) := Sym(7 downto 0) ;
+                  RxLen        := RxLen + 1 ;
+                end if ;
+              end case ;
+            end if ;
+          end loop ;
+
+        end if ;
+
+        -- ---------------------------------------------------
+        -- TLP output stream, returning a TLP's credits once its
+        -- last DWORD is taken
+        -- ---------------------------------------------------
+        if TlpOutValidInt = '1' and TlpOutReady = '1' then
+          if OutFifo(OutRd)(32) = '1' then
+            FcType              := TlpFcType(TlpRd) ;
+            FcAllocHdr(FcType)  := (FcAllocHdr(FcType)  + 1) mod 256 ;
+            FcAllocData(FcType) := (FcAllocData(FcType) + TlpFcData(TlpRd)) mod 4096 ;
+            FcUpdate(FcType)    := true ;
+            TlpRd               := (TlpRd + 1) mod MAXFIFOTLPS ;
+            TlpCount            := TlpCount - 1 ;
+          end if ;
+          OutRd    := (OutRd + 1) mod OUTFIFODEPTH ;
+          OutCount := OutCount - 1 ;
+        end if ;
+
+        if OutCount > 0 then
+          TlpOutValidInt <= '1' ;
+          TlpOutSop      <= OutFifo(OutRd)(33) ;
+          TlpOutEop      <= OutFifo(OutRd)(32) ;
+          TlpOutData     <= OutFifo(OutRd)(31 downto 0) ;
+        else
+          TlpOutValidInt <= '0' ;
+        end if ;
+
+        -- ---------------------------------------------------
+        -- TLP input stream
+        -- ---------------------------------------------------
+        if TlpInValid = '1' and TlpInReadyInt = '1' then
+          if TlpInSop = '1' then
+            InLen := 0 ;
+          end if ;
+
+          if InLen <= MAXPKTBYTES-4 then
+            for idx in 0 to 3 loop
+              InBuf(InLen+idx) := TlpInData(31-8*idx downto 24-8*idx) ;
+            end loop ;
+            InLen := InLen + 4 ;
+          end if ;
+
+          InTlpRdy := TlpInEop = '1' ;
+        end if ;
+
+        -- ---------------------------------------------------
+        -- Transmit to the model, loading the next packet
+        -- once the last has been sent
+        -- ---------------------------------------------------
+        if TxIdx >= TxLen then
+          TxLen := 0 ;
+          TxIdx := 0 ;
+
+          if not FcInit2Seen or FcInitCount < 2 then
+            QueueInitFc(FcInitCount >= 1) ;
+            FcInitCount := FcInitCount + 1 ;
+
+          elsif NakPending or AckPending then
+            Dllp(0)    := DLLP_NAK when NakPending else DLLP_ACK ;
+            Dllp(1)    := (others => '0') ;
+            Dllp(2)    := "0000" & AckSeq(11 downto 8) ;
+            Dllp(3)    := AckSeq(7 downto 0) ;
+            QueueDllp ;
+            AckPending := false ;
+            NakPending := false ;
+
+          elsif FcUpdate /= (0 to 2 => false) then
+            for Typ in 0 to 2 loop
+              if FcUpdate(Typ) then
+                QueueFc(DLLP_UPDATEFC, Typ) ;
+                FcUpdate(Typ) := false ;
+                exit ;
+              end if ;
+            end loop ;
+
+          elsif InTlpRdy then
+            Crc := (others => '1') ;
+            QueueSymbol(SYM_STP) ;
+            QueueSymbol('0' & "0000" & TxSeq(11 downto 8)) ;
+            QueueSymbol('0' & TxSeq(7 downto 0)) ;
+            Crc := CrcByte(Crc, "0000" & TxSeq(11 downto 8), LCRC_TABLE) ;
+            Crc := CrcByte(Crc, TxSeq(7 downto 0),           LCRC_TABLE) ;
+            for idx in 0 to InLen-1 loop
+              Crc := CrcByte(Crc, InBuf(idx), LCRC_TABLE) ;
+              QueueSymbol('0' & InBuf(idx)) ;
+            end loop ;
+            for idx in 0 to 3 loop
+              QueueSymbol('0' & CrcOutByte(Crc(31-8*idx downto 24-8*idx))) ;
+            end loop ;
+            QueueSymbol(SYM_END) ;
+            TxSeq    := TxSeq + 1 ;
+            InTlpRdy := false ;
+            InLen    := 0 ;
+          end if ;
+
+          -- Pad to a whole number of symbol times
+          if TxLen = 0 then
+            for lane in 0 to NUMOFLANES-1 loop
+              QueueSymbol(SYM_IDLE) ;
+            end loop ;
+          else
+            while (TxLen mod NUMOFLANES) /= 0 loop
+              QueueSymbol(SYM_PAD) ;
+            end loop ;
+          end if ;
+        end if ;
+
+        for lane in 0 to NUMOFLANES-1 loop
+          LinkToModel(lane) <= TxBuf(TxIdx + lane) ;
+        end loop ;
+        TxIdx := TxIdx + NUMOFLANES ;
+
+        -- Accept input stream data only when not holding a complete TLP
+        TlpInReadyInt <= '0' when InTlpRdy else '1' ;
+
+      end if ;
+    end if ;
+  end process StreamAdapter ;
+
+end architecture behavioural ;
@@ -41,4 +41,6 @@ analyze ./PcieMonitor_dummy.vhd
 analyze ./PciePassThru.vhd
 analyze ./PcieModelSerialiser.vhd
 analyze ./PcieContext.vhd
-analyze ./PcieModelSerial.vhd
\ No newline at end of file
+analyze ./PcieModelSerial.vhd
+analyze ./PcieTlpStreamAdapter.vhd
+analyze ./PcieModelTlpStream.vhd
\ No newline at end of file
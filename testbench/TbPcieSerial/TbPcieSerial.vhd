@@ -13,6 +13,7 @@
 
 --  Revision History:
 --    Date      Version    Description
+--    10/2026   2026.10    Added SYMBOL_MODE generic, for a symbol mode test run
 --    08/2025   2026.01    Initial revision
 --
 --
@@ -45,6 +46,9 @@ library osvvm_pcie ;
   context osvvm_pcie.PcieContext ;
 
 entity TbPcieSerial is
+  generic (
+    SYMBOL_MODE       : boolean := false  -- serialise whole symbols rather than bit by bit
+  ) ;
 end entity TbPcieSerial ;
 
 architecture TestHarness of TbPcieSerial is
@@ -131,7 +135,8 @@ begin
     REQ_ID            => US_NODE_NUM,
     EN_TLP_REQ_DIGEST => EN_TLP_REQ_DIGEST,
     ENDPOINT          => US_ENDPOINT,
-    ENABLE_AUTO       => US_ENABLE_AUTO
+    ENABLE_AUTO       => US_ENABLE_AUTO,
+    SYMBOL_MODE       => SYMBOL_MODE
   )
   port map (
     -- Globals
@@ -156,7 +161,8 @@ begin
     REQ_ID            => DS_NODE_NUM,
     EN_TLP_REQ_DIGEST => EN_TLP_REQ_DIGEST,
     ENDPOINT          => DS_ENDPOINT,
-    ENABLE_AUTO       => DS_ENABLE_AUTO
+    ENABLE_AUTO       => DS_ENABLE_AUTO,
+    SYMBOL_MODE       => SYMBOL_MODE
   )
   port map (
     -- Globals
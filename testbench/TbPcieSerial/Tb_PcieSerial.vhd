@@ -13,6 +13,7 @@
 --
 --  Revision History:
 --    Date      Version    Description
+--    10/2026   2026.10    Test name follows the harness SYMBOL_MODE
 --    10/2025   2026.01    Initial revision
 --
 --
@@ -39,6 +40,8 @@ architecture CoSimSerial of TestCtrl is
   signal   TestDone       : integer_barrier := 1 ;
   signal   Initialised    : boolean         := FALSE;
 
+  alias    SYMBOL_MODE is <<constant .TbPcieSerial.SYMBOL_MODE : boolean>> ;
+
 begin
 
   ------------------------------------------------------------
@@ -48,7 +51,7 @@ begin
   ControlProc : process
   begin
 
-    SetTestName("CoSim_PcieSerial");
+    SetTestName(IfElse(SYMBOL_MODE, "CoSim_PcieSerialSymbol", "CoSim_PcieSerial"));
 
     -- Initialization of test
     SetLogEnable(PASSED, TRUE) ;  -- Enable PASSED logs
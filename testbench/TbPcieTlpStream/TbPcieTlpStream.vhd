@@ -0,0 +1,225 @@
+--
+--  File Name:         TbPcieTlpStream.vhd
+--  Design Unit Name:  TbPcieTlpStream
+--  Revision:          OSVVM MODELS STANDARD VERSION
+--
+--  Maintainer:        Simon Southwell      email:  simon.southwell@gmail.com
+--  Contributor(s):
+--     Simon Southwell      simon.southwell@gmail.com
+--
+--
+--  Description:
+--      PCIe TLP stream wrapper test bench, with two PcieModelTlpStream
+--      models connected stream to stream. The downstream (model to
+--      model) stream has its valid/ready handshake randomly throttled
+--      to exercise back pressure, and can be stalled from the test
+--      (Stall) to exhaust the credits advertised to the upstream model.
+
+--  Revision History:
+--    Date      Version    Description
+--    10/2026   2026.10    Initial revision
+--
+--
+--  This file is part of OSVVM.
+--
+--  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md).
+--
+--  Licensed under the Apache License, Version 2.0 (the "License");
+--  you may not use this file except in compliance with the License.
+--  You may obtain a copy of the License at
+--
+--      https://www.apache.org/licenses/LICENSE-2.0
+--
+--  Unless required by applicable law or agreed to in writing, software
+--  distributed under the License is distributed on an "AS IS" BASIS,
+--  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+--  See the License for the specific language governing permissions and
+--  limitations under the License.
+--
+
+library ieee ;
+  use ieee.std_logic_1164.all ;
+  use ieee.numeric_std.all ;
+  use ieee.numeric_std_unsigned.all ;
+
+library osvvm ;
+  context osvvm.OsvvmContext ;
+
+library osvvm_pcie ;
+  context osvvm_pcie.PcieContext ;
+
+entity TbPcieTlpStream is
+end entity TbPcieTlpStream ;
+
+architecture TestHarness of TbPcieTlpStream is
+
+  constant tperiod_Clk : time :=   4 ns ; -- 250MHz for GEN1
+  constant tpd         : time := 100 ps ;
+
+  constant PCIE_ADDR_WIDTH   : integer := 64 ;
+  constant PCIE_DATA_WIDTH   : integer := 64 ;
+
+  -- Common configurations
+  constant EN_TLP_REQ_DIGEST : boolean := false ;
+  constant THROTTLE_PERCENT  : integer := 25 ; -- percentage of cycles the downstream stream is stalled
+
+  -- Downstream (EP) device configuration
+  constant DS_NODE_NUM       : integer := 63 ;
+  constant DS_ENDPOINT       : boolean := true ;
+  constant DS_ENABLE_AUTO    : boolean := true ;
+
+  -- Upstream (RC) device configuration
+  constant US_NODE_NUM       : integer := 62 ;
+  constant US_ENDPOINT       : boolean := false ;
+  constant US_ENABLE_AUTO    : boolean := false ;
+
+  signal Clk                 : std_logic := '1';
+  signal nReset              : std_logic := '0';
+
+  signal UpstreamRec, DownstreamRec  : AddressBusRecType(
+          Address      (PCIE_ADDR_WIDTH-1 downto 0),
+          DataToModel  (PCIE_DATA_WIDTH-1 downto 0),
+          DataFromModel(PCIE_DATA_WIDTH-1 downto 0)
+        ) ;
+
+  -- TLP streams, upstream model to downstream model (Dn) and back (Up)
+  signal   DnData, UpData                  : std_logic_vector (31 downto 0) ;
+  signal   DnSop,  UpSop                   : std_logic ;
+  signal   DnEop,  UpEop                   : std_logic ;
+  signal   DnValid, DnValidOut, UpValid    : std_logic ;
+  signal   DnReady, DnReadyIn,  UpReady    : std_logic ;
+
+  signal   Throttle                        : std_logic := '0' ;
+  signal   Stall                           : std_logic := '0' ;  -- driven from TestCtrl
+
+  component TestCtrl is
+    port (
+      -- Global Signal Interface
+      Clk                 : In    std_logic ;
+      nReset              : In    std_logic ;
+
+      -- Transaction Interfaces
+      UpstreamRec          : inout AddressBusRecType ;
+      DownstreamRec        : inout AddressBusRecType
+    ) ;
+  end component TestCtrl ;
+
+begin
+
+  ------------------------------------------------------------
+  -- create Clock
+  ------------------------------------------------------------
+  Osvvm.ClockResetPkg.CreateClock (
+    Clk        => Clk,
+    Period     => Tperiod_Clk
+  )  ;
+
+  ------------------------------------------------------------
+  -- create nReset
+  ------------------------------------------------------------
+  Osvvm.ClockResetPkg.CreateReset (
+    Reset       => nReset,
+    ResetActive => '0',
+    Clk         => Clk,
+    Period      => 7 * tperiod_Clk,
+    tpd         => tpd
+  ) ;
+
+  ------------------------------------------------------------
+  -- Randomly stall the downstream stream, changing away from
+  -- the rising edges the stream is clocked on
+  ------------------------------------------------------------
+  ThrottleProc : process
+    variable ThrottleRV : RandomPType ;
+  begin
+    ThrottleRV.InitSeed(ThrottleRV'instance_name) ;
+
+    loop
+      wait until falling_edge(Clk) ;
+      Throttle <= '1' when ThrottleRV.RandInt(1, 100) <= THROTTLE_PERCENT else '0' ;
+    end loop ;
+  end process ThrottleProc ;
+
+  DnValid   <= DnValidOut and not (Throttle or Stall) ;
+  DnReadyIn <= DnReady    and not (Throttle or Stall) ;
+
+  ------------------------------------------------------------
+  Upstream_1 : PcieModelTlpStream
+  ------------------------------------------------------------
+  generic map (
+    NODE_NUM          => US_NODE_NUM,
+    REQ_ID            => US_NODE_NUM,
+    EN_TLP_REQ_DIGEST => EN_TLP_REQ_DIGEST,
+    ENDPOINT          => US_ENDPOINT,
+    ENABLE_AUTO       => US_ENABLE_AUTO
+  )
+  port map (
+    -- Globals
+    Clk         => Clk,
+    nReset      => nReset,
+
+    -- Test bench Transaction Interface
+    TransRec    => UpstreamRec,
+
+    -- TLP stream to downstream
+    TlpOutData  => DnData,
+    TlpOutSop   => DnSop,
+    TlpOutEop   => DnEop,
+    TlpOutValid => DnValidOut,
+    TlpOutReady => DnReadyIn,
+
+    -- TLP stream from downstream
+    TlpInData   => UpData,
+    TlpInSop    => UpSop,
+    TlpInEop    => UpEop,
+    TlpInValid  => UpValid,
+    TlpInReady  => UpReady
+  ) ;
+
+  ------------------------------------------------------------
+  Downstream_1 : PcieModelTlpStream
+  ------------------------------------------------------------
+  generic map (
+    NODE_NUM          => DS_NODE_NUM,
+    REQ_ID            => DS_NODE_NUM,
+    EN_TLP_REQ_DIGEST => EN_TLP_REQ_DIGEST,
+    ENDPOINT          => DS_ENDPOINT,
+    ENABLE_AUTO       => DS_ENABLE_AUTO
+  )
+  port map (
+    -- Globals
+    Clk         => Clk,
+    nReset      => nReset,
+
+    -- Test bench Transaction Interface
+    TransRec    => DownstreamRec,
+
+    -- TLP stream to upstream
+    TlpOutData  => UpData,
+    TlpOutSop   => UpSop,
+    TlpOutEop   => UpEop,
+    TlpOutValid => UpValid,
+    TlpOutReady => UpReady,
+
+    -- TLP stream from upstream
+    TlpInData   => DnData,
+    TlpInSop    => DnSop,
+    TlpInEop    => DnEop,
+    TlpInValid  => DnValid,
+    TlpInReady  => DnReady
+  ) ;
+
+  ------------------------------------------------------------
+  TestCtrl_1 : TestCtrl
+  ------------------------------------------------------------
+  port map (
+    -- Globals
+    Clk            => Clk,
+    nReset         => nReset,
+
+    -- Testbench Transaction Interfaces
+    UpstreamRec    => UpstreamRec,
+    DownstreamRec  => DownstreamRec
+  ) ;
+
+end architecture TestHarness ;
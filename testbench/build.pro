@@ -50,6 +50,11 @@ ChangeWorkingDirectory ../TbPcieSerial
 analyze TbPcieSerial.vhd
 analyze Tb_PcieSerial.vhd
 
+ChangeWorkingDirectory ../TbPcieTlpStream
+
+analyze TbPcieTlpStream.vhd
+analyze Tb_PcieTlpStream.vhd
+
 if {($::osvvm::ToolName eq "Questa") || ($::osvvm::ToolName eq "RivieraPRO")} {
 
   ChangeWorkingDirectory ../TbPcieAltera
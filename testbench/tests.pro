@@ -17,6 +17,12 @@ simulate   Tb_PCIeAutoEp [CoSim]
 TestName   CoSim_PcieSerial
 simulate   Tb_PCIeSerial [CoSim]
 
+TestName   CoSim_PcieSerialSymbol
+simulate   Tb_PCIeSerial [generic SYMBOL_MODE true] [CoSim]
+
+TestName   CoSim_PcieTlpStream
+simulate   Tb_PCIeTlpStream [CoSim]
+
 if {($::osvvm::ToolName eq "Questa") || ($::osvvm::ToolName eq "FPGA")} {
 
   SetExtendedSimulateOptions +nowarnPCDPC
@@ -33,3 +39,9 @@ if {($::osvvm::ToolName eq "Questa") || ($::osvvm::ToolName eq "FPGA")} {
   simulate Tb_PCIeAltera [CoSim]
 }
 
+# C++ API test, with its own user code replacing that of the VC interface
+ChangeWorkingDirectory ../../tests
+MkVproc    api
+
+ChangeWorkingDirectory ../testbench/TbPcie
+RunTest Tb_Pcie_Api.vhd [CoSim]
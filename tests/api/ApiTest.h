@@ -0,0 +1,98 @@
+// =========================================================================
+//
+//  File Name:         ApiTest.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    Common definitions for the co-sim tests of the PCIe model C++ API,
+//    with the tests of each feature in their own ApiTest*.cpp file
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#ifndef _APITEST_H_
+#define _APITEST_H_
+
+#include "pcieModelClass.h"
+
+// Test state of a node, passed to each of its tests
+typedef struct {
+    pcieModelClass* pcie;
+    unsigned        node;
+    int             errors;
+    int             unexpected;      // TLPs reaching the user callback unclaimed by a test
+    int             batches;         // Receive batches passed to the RC's batch callback
+    pcieTlpHdr_t    lastHdr;         // Decoded header of the last TLP in the RC's batches
+    pcieTlp         lastTlp;         // Last TLP passed to the EP's packet handle callback
+} apiTestCtx_t;
+
+typedef void (*apiTest_t)(apiTestCtx_t &ctx);
+
+// Support routines (VUserMainApi.cpp)
+extern void apiTestError          (apiTestCtx_t &ctx, const char* msg);
+extern void apiCheckData          (apiTestCtx_t &ctx, const PktData_t* exp, const PktData_t* act, const int length, const char* msg);
+extern void apiFill               (apiTestCtx_t &ctx, PktData_t* buf, const int length);
+
+// Requester tests, run by the RC (node 62)
+extern void apiTestGen3           (apiTestCtx_t &ctx);            // ApiTestGen3.cpp
+extern void apiTestAsyncReads     (apiTestCtx_t &ctx);            // ApiTestAsync.cpp
+extern void apiTestBursts         (apiTestCtx_t &ctx);            // ApiTestBurst.cpp
+extern void apiTestCompleter      (apiTestCtx_t &ctx);            // ApiTestCompleter.cpp
+extern void apiTestFc             (apiTestCtx_t &ctx);            // ApiTestFc.cpp
+extern void apiTestAck            (apiTestCtx_t &ctx);            // ApiTestAck.cpp
+extern void apiTestVc             (apiTestCtx_t &ctx);            // ApiTestVc.cpp
+extern void apiTestLatency        (apiTestCtx_t &ctx);            // ApiTestLatency.cpp
+extern void apiTestLinkUtil       (apiTestCtx_t &ctx);            // ApiTestLinkUtil.cpp
+extern void apiTestTrafficGen     (apiTestCtx_t &ctx);            // ApiTestTrafficGen.cpp
+extern void apiTestShadow         (apiTestCtx_t &ctx);            // ApiTestShadow.cpp
+extern void apiTestFifoBlock      (apiTestCtx_t &ctx);            // ApiTestFifoBlock.cpp
+extern void apiTestParamsBlock    (apiTestCtx_t &ctx);            // ApiTestParamsBlock.cpp
+extern void apiTestBatch          (apiTestCtx_t &ctx);            // ApiTestBatch.cpp
+extern void apiTestTlpHdr         (apiTestCtx_t &ctx);            // ApiTestTlpHdr.cpp
+extern void apiTestTlp            (apiTestCtx_t &ctx);            // ApiTestTlp.cpp
+extern void apiTestCoSched        (apiTestCtx_t &ctx);            // ApiTestCoSched.cpp
+extern void apiTestAspm           (apiTestCtx_t &ctx);            // ApiTestAspm.cpp
+extern void apiTestRng            (apiTestCtx_t &ctx);            // ApiTestRng.cpp
+
+// EP set up, run before the RC starts its tests
+extern void apiSetupCompleter     (apiTestCtx_t &ctx);            // ApiTestCompleter.cpp
+extern void apiSetupFc            (apiTestCtx_t &ctx);            // ApiTestFc.cpp
+extern void apiSetupAck           (apiTestCtx_t &ctx);            // ApiTestAck.cpp
+extern void apiSetupVc            (apiTestCtx_t &ctx);            // ApiTestVc.cpp
+
+// EP checks, run once the RC has finished its tests
+extern void apiCheckFc            (apiTestCtx_t &ctx);            // ApiTestFc.cpp
+extern void apiCheckAck           (apiTestCtx_t &ctx);            // ApiTestAck.cpp
+extern void apiCheckVc            (apiTestCtx_t &ctx);            // ApiTestVc.cpp
+extern void apiCheckTransWait     (apiTestCtx_t &ctx);            // ApiTestTransWait.cpp
+extern void apiCheckTlp           (apiTestCtx_t &ctx);            // ApiTestTlp.cpp
+extern void apiCheckAspm          (apiTestCtx_t &ctx);            // ApiTestAspm.cpp
+
+// EP idling, called repeatedly while the RC runs its tests
+extern void apiIdleAspm           (apiTestCtx_t &ctx);            // ApiTestAspm.cpp
+
+#endif
@@ -0,0 +1,99 @@
+// =========================================================================
+//
+//  File Name:         ApiTestAck.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    C++ API test of the Ack/Nak latency timer and Ack coalescing
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <vector>
+
+#include "ApiTest.h"
+
+#define ACK_TEST_ADDR                0x00006000ULL
+#define ACK_TEST_BYTES               2048
+
+//-------------------------------------------------------------
+// apiSetupAck()
+//
+// EP acknowledging TLPs on the Ack latency timer
+//-------------------------------------------------------------
+
+void apiSetupAck (apiTestCtx_t &ctx)
+{
+    ctx.pcie->setAckLatency(true);
+}
+
+//-------------------------------------------------------------
+// apiTestAck()
+//
+// Back-to-back writes, for the EP to acknowledge with
+// coalesced Acks, read back to check none were lost
+//-------------------------------------------------------------
+
+void apiTestAck (apiTestCtx_t &ctx)
+{
+    pcieModelClass*        pcie = ctx.pcie;
+    std::vector<PktData_t> wbuf(ACK_TEST_BYTES);
+    std::vector<PktData_t> rbuf(ACK_TEST_BYTES);
+
+    apiFill(ctx, wbuf.data(), ACK_TEST_BYTES);
+
+    pcie->memWriteBurst(ACK_TEST_ADDR, wbuf.data(), ACK_TEST_BYTES, ctx.node);
+
+    if (!pcie->memReadBurst(ACK_TEST_ADDR, rbuf.data(), ACK_TEST_BYTES, ctx.node))
+    {
+        apiTestError(ctx, "read back of acknowledged writes did not complete successfully");
+    }
+
+    apiCheckData(ctx, wbuf.data(), rbuf.data(), ACK_TEST_BYTES, "read back of acknowledged writes data mismatch");
+}
+
+//-------------------------------------------------------------
+// apiCheckAck()
+//
+// EP acknowledged all TLPs with fewer Acks than TLPs, and
+// with no Naks or duplicates on an error free link
+//-------------------------------------------------------------
+
+void apiCheckAck (apiTestCtx_t &ctx)
+{
+    pcieModelClass* pcie = ctx.pcie;
+
+    if (pcie->getNumAcks() == 0 || pcie->getNumAcks() >= pcie->getNumAckedTlps())
+    {
+        apiTestError(ctx, "Acks not coalesced");
+    }
+
+    if (pcie->getNumNaks() || pcie->getNumDuplicateTlps())
+    {
+        apiTestError(ctx, "Naks or duplicate TLPs on an error free link");
+    }
+}
@@ -0,0 +1,202 @@
+// =========================================================================
+//
+//  File Name:         ApiTestAspm.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    C++ API test of ASPM L0s and L1 entry and exit, with the L1
+//    handshake between the nodes
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <atomic>
+
+#include "ApiTest.h"
+
+extern "C" {
+#include "ltssm.h"
+}
+
+#define ASPM_TEST_SETTLE_CYCLES      200
+#define ASPM_TEST_L0S_IDLE           64
+#define ASPM_TEST_L0S_CYCLES         300
+#define ASPM_TEST_EP_L1_IDLE         256
+#define ASPM_TEST_RC_L1_IDLE         100000
+#define ASPM_TEST_L1_TIMEOUT         4000
+#define ASPM_TEST_L1_CYCLES          200
+#define ASPM_TEST_POLL_CYCLES        16
+
+// Test phases, stepped by the RC, with the EP taking part while it idles
+#define ASPM_PHASE_NONE              0
+#define ASPM_PHASE_L1                1
+#define ASPM_PHASE_EXIT              2
+#define ASPM_PHASE_DONE              3
+
+static std::atomic<int> aspmPhase(ASPM_PHASE_NONE);
+static bool             epL1Enabled = false;
+
+//-------------------------------------------------------------
+// apiTestAspm()
+//
+// L0s entry on the RC's idle timer, then L1 entry requested by
+// the EP and acknowledged by the RC, both exiting together
+// through Recovery
+//-------------------------------------------------------------
+
+void apiTestAspm (apiTestCtx_t &ctx)
+{
+    pcieModelClass* pcie = ctx.pcie;
+
+    // No TLPs awaiting acknowledgement, as AspmIdle() requires
+    pcie->sendIdle(ASPM_TEST_SETTLE_CYCLES);
+
+    ResetAspmStats(ctx.node);
+
+    // ---- L0s ----
+
+    ConfigurePcieLtssm(CONFIG_LTSSM_ASPM_L0S_IDLE, ASPM_TEST_L0S_IDLE, ctx.node);
+    ConfigurePcieLtssm(CONFIG_LTSSM_ASPM_CTL, ASPM_CTL_L0S, ctx.node);
+
+    AspmIdle(ASPM_TEST_L0S_CYCLES, ctx.node);
+
+    if (GetAspmState(ctx.node) != ASPM_STATE_L0S)
+    {
+        apiTestError(ctx, "L0s not entered after its idle time");
+    }
+
+    AspmExit(ctx.node);
+
+    // ---- L1 ----
+
+    // Acknowledging the EP's request, with the RC's own idle time too long to make one.
+    // The PM DLLPs of a batch reach AspmRxDllp() when it is flushed.
+    ConfigurePcieLtssm(CONFIG_LTSSM_ASPM_L1_IDLE, ASPM_TEST_RC_L1_IDLE, ctx.node);
+    ConfigurePcieLtssm(CONFIG_LTSSM_ASPM_CTL, ASPM_CTL_L1, ctx.node);
+
+    aspmPhase = ASPM_PHASE_L1;
+
+    uint32_t start = pcie->getCycleCount();
+
+    while (GetAspmState(ctx.node) != ASPM_STATE_L1 && pcie->getCycleCount() - start < ASPM_TEST_L1_TIMEOUT)
+    {
+        AspmIdle(ASPM_TEST_POLL_CYCLES, ctx.node);
+        pcie->flushRxBatch();
+    }
+
+    if (GetAspmState(ctx.node) != ASPM_STATE_L1)
+    {
+        apiTestError(ctx, "L1 not entered on the EP's request");
+    }
+
+    AspmIdle(ASPM_TEST_L1_CYCLES, ctx.node);
+
+    aspmPhase = ASPM_PHASE_EXIT;
+
+    AspmExit(ctx.node);
+
+    while (aspmPhase != ASPM_PHASE_DONE)
+    {
+        pcie->sendIdle(1);
+    }
+
+    ConfigurePcieLtssm(CONFIG_LTSSM_ASPM_CTL, 0, ctx.node);
+
+    // ---- Statistics ----
+
+    if (ReadAspmStat(ASPM_STATE_L0S, ASPM_STAT_ENTRIES, ctx.node) != 1 ||
+        ReadAspmStat(ASPM_STATE_L0S, ASPM_STAT_EXITS,   ctx.node) != 1 ||
+        ReadAspmStat(ASPM_STATE_L1,  ASPM_STAT_ENTRIES, ctx.node) != 1 ||
+        ReadAspmStat(ASPM_STATE_L1,  ASPM_STAT_EXITS,   ctx.node) != 1)
+    {
+        apiTestError(ctx, "ASPM entry and exit counts incorrect");
+    }
+
+    if (ReadAspmStat(ASPM_STATE_L0S, ASPM_STAT_RESIDENCY,   ctx.node) == 0 ||
+        ReadAspmStat(ASPM_STATE_L0S, ASPM_STAT_EXIT_CYCLES, ctx.node) == 0 ||
+        ReadAspmStat(ASPM_STATE_L1,  ASPM_STAT_RESIDENCY,   ctx.node) < ASPM_TEST_L1_CYCLES ||
+        ReadAspmStat(ASPM_STATE_L1,  ASPM_STAT_EXIT_CYCLES, ctx.node) == 0)
+    {
+        apiTestError(ctx, "ASPM residency or exit cycles not recorded");
+    }
+}
+
+//-------------------------------------------------------------
+// apiIdleAspm()
+//
+// The EP's idling while the RC runs its tests, under the ASPM
+// policy for the L1 phase of the RC's test, requesting L1 once
+// idle for long enough
+//-------------------------------------------------------------
+
+void apiIdleAspm (apiTestCtx_t &ctx)
+{
+    switch (aspmPhase)
+    {
+    case ASPM_PHASE_L1:
+        if (!epL1Enabled)
+        {
+            ResetAspmStats(ctx.node);
+            ConfigurePcieLtssm(CONFIG_LTSSM_ASPM_L1_IDLE, ASPM_TEST_EP_L1_IDLE, ctx.node);
+            ConfigurePcieLtssm(CONFIG_LTSSM_ASPM_CTL, ASPM_CTL_L1, ctx.node);
+            epL1Enabled = true;
+        }
+
+        AspmIdle(ASPM_TEST_POLL_CYCLES, ctx.node);
+        break;
+
+    case ASPM_PHASE_EXIT:
+        AspmExit(ctx.node);
+        ConfigurePcieLtssm(CONFIG_LTSSM_ASPM_CTL, 0, ctx.node);
+        aspmPhase = ASPM_PHASE_DONE;
+        break;
+
+    default:
+        ctx.pcie->sendIdle(1);
+        break;
+    }
+}
+
+//-------------------------------------------------------------
+// apiCheckAspm()
+//
+// The EP entered and left L1 once
+//-------------------------------------------------------------
+
+void apiCheckAspm (apiTestCtx_t &ctx)
+{
+    if (aspmPhase != ASPM_PHASE_DONE)
+    {
+        apiTestError(ctx, "ASPM test did not complete");
+    }
+
+    if (ReadAspmStat(ASPM_STATE_L1, ASPM_STAT_ENTRIES, ctx.node) != 1 ||
+        ReadAspmStat(ASPM_STATE_L1, ASPM_STAT_EXITS,   ctx.node) != 1)
+    {
+        apiTestError(ctx, "EP ASPM L1 entry and exit counts incorrect");
+    }
+}
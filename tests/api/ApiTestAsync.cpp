@@ -0,0 +1,132 @@
+// =========================================================================
+//
+//  File Name:         ApiTestAsync.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    C++ API test of non-blocking read requests and the tag table
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <algorithm>
+#include <vector>
+
+#include "ApiTest.h"
+
+#define ASYNC_ADDR                   0x00001000ULL
+#define ASYNC_NUM_READS              8
+#define ASYNC_READ_BYTES             64
+#define ASYNC_MAX_OUTSTANDING        2
+#define ASYNC_TAG                    0x35
+
+//-------------------------------------------------------------
+// apiTestAsyncReads()
+//
+// Reads issued back to back before waiting, first with
+// automatically allocated tags and then limited to fewer
+// outstanding requests than issued, and a read with an
+// explicit tag
+//-------------------------------------------------------------
+
+void apiTestAsyncReads (apiTestCtx_t &ctx)
+{
+    pcieModelClass*            pcie = ctx.pcie;
+    std::vector<PktData_t>     wbuf(ASYNC_NUM_READS * ASYNC_READ_BYTES);
+    std::vector<PktData_t>     rbuf(ASYNC_NUM_READS * ASYNC_READ_BYTES);
+    std::vector<pcieRequest_t> req(ASYNC_NUM_READS);
+
+    apiFill(ctx, wbuf.data(), (int)wbuf.size());
+
+    for (int idx = 0; idx < ASYNC_NUM_READS; idx++)
+    {
+        pcie->memWrite(ASYNC_ADDR + idx * ASYNC_READ_BYTES, &wbuf[idx * ASYNC_READ_BYTES], ASYNC_READ_BYTES, 0, ctx.node);
+    }
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        std::fill(rbuf.begin(), rbuf.end(), 0);
+
+        pcie->setMaxOutstanding(pass ? ASYNC_MAX_OUTSTANDING : ASYNC_NUM_READS);
+
+        for (int idx = 0; idx < ASYNC_NUM_READS; idx++)
+        {
+            if (pcie->memReadAsync(ASYNC_ADDR + idx * ASYNC_READ_BYTES, &rbuf[idx * ASYNC_READ_BYTES], ASYNC_READ_BYTES, ctx.node, &req[idx]) < 0)
+            {
+                apiTestError(ctx, "non-blocking read not issued");
+            }
+
+            if (pcie->getNumOutstanding() > (pass ? ASYNC_MAX_OUTSTANDING : ASYNC_NUM_READS))
+            {
+                apiTestError(ctx, "outstanding request limit exceeded");
+            }
+        }
+
+        pcie->waitForAllRequests();
+
+        for (int idx = 0; idx < ASYNC_NUM_READS; idx++)
+        {
+            if (!pcie->isComplete(&req[idx]) || req[idx].state != PCIE_REQ_COMPLETE ||
+                req[idx].cplStatus != CPL_SUCCESS || req[idx].received != ASYNC_READ_BYTES)
+            {
+                apiTestError(ctx, "non-blocking read did not complete successfully");
+            }
+        }
+
+        apiCheckData(ctx, wbuf.data(), rbuf.data(), (int)wbuf.size(), "non-blocking read data mismatch");
+    }
+
+    pcie->setMaxOutstanding(1 << PCIE_TAG_BITS_8);
+
+    // Explicit tag, which must be reported as used
+    if (pcie->memReadAsync(ASYNC_ADDR, rbuf.data(), ASYNC_READ_BYTES, ctx.node, &req[0], ASYNC_TAG) != ASYNC_TAG)
+    {
+        apiTestError(ctx, "non-blocking read with explicit tag not issued with the tag");
+    }
+
+    if (!pcie->waitForRequest(&req[0]) || req[0].tag != ASYNC_TAG)
+    {
+        apiTestError(ctx, "non-blocking read with explicit tag did not complete successfully");
+    }
+
+    apiCheckData(ctx, wbuf.data(), rbuf.data(), ASYNC_READ_BYTES, "non-blocking read with explicit tag data mismatch");
+
+    // Configuration read of the EP's vendor and device IDs
+    PktData_t cfg[4];
+
+    pcie->cfgReadAsync(0, cfg, 4, ctx.node, &req[0]);
+
+    if (!pcie->waitForRequest(&req[0]) || req[0].received != 4)
+    {
+        apiTestError(ctx, "non-blocking configuration read did not complete successfully");
+    }
+
+    if (pcie->getNumOutstanding())
+    {
+        apiTestError(ctx, "requests outstanding after all have completed");
+    }
+}
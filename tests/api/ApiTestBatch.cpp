@@ -0,0 +1,77 @@
+// =========================================================================
+//
+//  File Name:         ApiTestBatch.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    C++ API test of the batched receive callback
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include "ApiTest.h"
+
+#define BATCH_TEST_ADDR              0x0000c000ULL
+#define BATCH_TEST_NUM_READS         8
+#define BATCH_TEST_BYTES             16
+#define BATCH_TEST_TAG_BASE          0x80
+#define BATCH_TEST_WAIT_CYCLES       400
+
+//-------------------------------------------------------------
+// apiTestBatch()
+//
+// Completions for reads not tracked by the class reach the RC's
+// batch callback, which counts them as unexpected, and are
+// claimed here
+//-------------------------------------------------------------
+
+void apiTestBatch (apiTestCtx_t &ctx)
+{
+    pcieModelClass* pcie         = ctx.pcie;
+    int             unexpected   = ctx.unexpected;
+    int             batches      = ctx.batches;
+
+    for (int idx = 0; idx < BATCH_TEST_NUM_READS; idx++)
+    {
+        pcie->memRead(BATCH_TEST_ADDR + idx*BATCH_TEST_BYTES, BATCH_TEST_BYTES, BATCH_TEST_TAG_BASE + idx, ctx.node);
+    }
+
+    // Batches are passed on at the end of the call, and for each cycle idled within the class
+    pcie->sendIdle(BATCH_TEST_WAIT_CYCLES);
+
+    if (ctx.unexpected - unexpected != BATCH_TEST_NUM_READS)
+    {
+        apiTestError(ctx, "batched completion count does not match the reads made");
+    }
+
+    if (ctx.batches == batches)
+    {
+        apiTestError(ctx, "no receive batches delivered");
+    }
+
+    ctx.unexpected = unexpected;
+}
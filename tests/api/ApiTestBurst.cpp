@@ -0,0 +1,83 @@
+// =========================================================================
+//
+//  File Name:         ApiTestBurst.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    C++ API test of burst transfers split on MPS and MRRS
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <vector>
+
+#include "ApiTest.h"
+
+// Unaligned, crossing a 4KB boundary
+#define BURST_ADDR                   0x00002f3aULL
+#define BURST_BYTES                  1500
+
+//-------------------------------------------------------------
+// apiTestBursts()
+//
+// A burst longer than both the max payload and max read
+// request sizes, written and read back, and a short burst
+// sent as a single TLP
+//-------------------------------------------------------------
+
+void apiTestBursts (apiTestCtx_t &ctx)
+{
+    pcieModelClass*        pcie = ctx.pcie;
+    std::vector<PktData_t> wbuf(BURST_BYTES);
+    std::vector<PktData_t> rbuf(BURST_BYTES);
+
+    int mps = pcie->getMaxPayloadSize();
+
+    apiFill(ctx, wbuf.data(), BURST_BYTES);
+
+    if (pcie->memWriteBurst(BURST_ADDR, wbuf.data(), BURST_BYTES, ctx.node) <= BURST_BYTES / mps)
+    {
+        apiTestError(ctx, "write burst not split on max payload size");
+    }
+
+    if (!pcie->memReadBurst(BURST_ADDR, rbuf.data(), BURST_BYTES, ctx.node))
+    {
+        apiTestError(ctx, "read burst did not complete successfully");
+    }
+
+    apiCheckData(ctx, wbuf.data(), rbuf.data(), BURST_BYTES, "burst read data mismatch");
+
+    if (pcie->memWriteBurst(BURST_ADDR, wbuf.data(), mps / 2, ctx.node) != 1)
+    {
+        apiTestError(ctx, "short write burst not sent as a single TLP");
+    }
+
+    if (pcie->getNumOutstanding())
+    {
+        apiTestError(ctx, "requests outstanding after read burst");
+    }
+}
@@ -0,0 +1,151 @@
+// =========================================================================
+//
+//  File Name:         ApiTestCoSched.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    C++ API test of the coroutine request stream scheduler, when built as
+//    C++20 with coroutine support
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include "ApiTest.h"
+#include "pcieCoSched.h"
+
+#define CO_TEST_ADDR                 0x0000e000ULL
+#define CO_TEST_STREAMS              4
+#define CO_TEST_READS                4
+#define CO_TEST_BYTES                16
+#define CO_TEST_SLEEPS               3
+#define CO_TEST_SLEEP_CYCLES         50
+
+#if defined(__cpp_impl_coroutine) && defined(__cpp_lib_coroutine)
+
+// Byte written to, and read back from, an address of the test region
+static PktData_t coTestByte (const uint64_t addr)
+{
+    return (PktData_t)((addr * 3 + 0x5c) & BYTE_MASK);
+}
+
+// Reads interleaved with those of the other streams, checking the data
+static pcieCoTask coReadStream (pcieCoSched &sched, apiTestCtx_t &ctx, const int stream, int &reads)
+{
+    PktData_t rbuf[CO_TEST_BYTES];
+    PktData_t exp[CO_TEST_BYTES];
+
+    for (int idx = 0; idx < CO_TEST_READS; idx++)
+    {
+        uint64_t addr = CO_TEST_ADDR + (idx * CO_TEST_STREAMS + stream) * CO_TEST_BYTES;
+
+        if (!co_await sched.memReadAsync(addr, rbuf, CO_TEST_BYTES, ctx.node))
+        {
+            apiTestError(ctx, "coroutine stream read failed");
+            co_return;
+        }
+
+        for (int bdx = 0; bdx < CO_TEST_BYTES; bdx++)
+        {
+            exp[bdx] = coTestByte(addr + bdx);
+        }
+
+        apiCheckData(ctx, exp, rbuf, CO_TEST_BYTES, "coroutine stream read data mismatch");
+
+        reads++;
+    }
+}
+
+// Cycle waits, running alongside the read streams
+static pcieCoTask coSleepStream (pcieCoSched &sched, apiTestCtx_t &ctx, int &sleeps)
+{
+    for (int idx = 0; idx < CO_TEST_SLEEPS; idx++)
+    {
+        uint32_t start = ctx.pcie->getCycleCount();
+
+        co_await sched.waitCycles(CO_TEST_SLEEP_CYCLES);
+
+        if (ctx.pcie->getCycleCount() - start < CO_TEST_SLEEP_CYCLES)
+        {
+            apiTestError(ctx, "coroutine stream resumed before its cycles elapsed");
+        }
+
+        sleeps++;
+    }
+}
+
+#endif
+
+//-------------------------------------------------------------
+// apiTestCoSched()
+//
+// Concurrent read streams and a cycle wait stream on the RC's
+// one user thread, all run to completion by the scheduler.
+// Built without coroutine support, the test is skipped.
+//-------------------------------------------------------------
+
+void apiTestCoSched (apiTestCtx_t &ctx)
+{
+#if defined(__cpp_impl_coroutine) && defined(__cpp_lib_coroutine)
+
+    pcieModelClass* pcie   = ctx.pcie;
+    pcieCoSched     sched(pcie);
+    PktData_t       wbuf[CO_TEST_BYTES];
+    int             reads  = 0;
+    int             sleeps = 0;
+
+    for (int blk = 0; blk < CO_TEST_STREAMS * CO_TEST_READS; blk++)
+    {
+        uint64_t addr = CO_TEST_ADDR + blk * CO_TEST_BYTES;
+
+        for (int bdx = 0; bdx < CO_TEST_BYTES; bdx++)
+        {
+            wbuf[bdx] = coTestByte(addr + bdx);
+        }
+
+        pcie->memWrite(addr, wbuf, CO_TEST_BYTES, 0, ctx.node);
+    }
+
+    for (int stream = 0; stream < CO_TEST_STREAMS; stream++)
+    {
+        sched.spawn(coReadStream(sched, ctx, stream, reads));
+    }
+
+    sched.spawn(coSleepStream(sched, ctx, sleeps));
+
+    sched.run();
+
+    if (reads != CO_TEST_STREAMS * CO_TEST_READS || sleeps != CO_TEST_SLEEPS || sched.getNumTasks() != 0)
+    {
+        apiTestError(ctx, "coroutine streams did not all run to completion");
+    }
+
+#else
+
+    VPrint("VUserMainApi: coroutine scheduler test skipped, not built as C++20 (node %d)\n", ctx.node);
+
+#endif
+}
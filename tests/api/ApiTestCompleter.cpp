@@ -0,0 +1,101 @@
+// =========================================================================
+//
+//  File Name:         ApiTestCompleter.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    C++ API test of the RCB aware memory completer
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <vector>
+
+#include "ApiTest.h"
+
+#define CPL_TEST_CID                 0x0100
+#define CPL_TEST_ADDR                0x00004014ULL
+#define CPL_TEST_BYTES               600
+
+// Tags only a completer echoing T9/T8 will complete
+#define CPL_TEST_MEM_TAG             0x2a5
+#define CPL_TEST_CFG_TAG             0x15a
+
+//-------------------------------------------------------------
+// apiSetupCompleter()
+//
+// EP memory completer, with a completion for each RCB
+//-------------------------------------------------------------
+
+void apiSetupCompleter (apiTestCtx_t &ctx)
+{
+    ctx.pcie->enableCompleter(CPL_TEST_CID, PCIE_CPL_SPLIT_RCB);
+}
+
+//-------------------------------------------------------------
+// apiTestCompleter()
+//
+// Reads completed by the EP's completer, as several RCB
+// completions from an unaligned address, using 10 bit tags
+// which the model's internal completer cannot return
+//-------------------------------------------------------------
+
+void apiTestCompleter (apiTestCtx_t &ctx)
+{
+    pcieModelClass*        pcie = ctx.pcie;
+    std::vector<PktData_t> wbuf(CPL_TEST_BYTES);
+    std::vector<PktData_t> rbuf(CPL_TEST_BYTES);
+    pcieRequest_t          req;
+    PktData_t              cfg[4];
+
+    if (!pcie->setTagBits(PCIE_TAG_BITS_10))
+    {
+        apiTestError(ctx, "10 bit tags not selected");
+        return;
+    }
+
+    apiFill(ctx, wbuf.data(), CPL_TEST_BYTES);
+
+    pcie->memWrite(CPL_TEST_ADDR, wbuf.data(), CPL_TEST_BYTES, 0, ctx.node);
+
+    if (pcie->memReadAsync(CPL_TEST_ADDR, rbuf.data(), CPL_TEST_BYTES, ctx.node, &req, CPL_TEST_MEM_TAG) != CPL_TEST_MEM_TAG ||
+        !pcie->waitForRequest(&req) || req.received != CPL_TEST_BYTES)
+    {
+        apiTestError(ctx, "read with 10 bit tag not completed by the completer");
+    }
+
+    apiCheckData(ctx, wbuf.data(), rbuf.data(), CPL_TEST_BYTES, "completer read data mismatch");
+
+    // Configuration reads are completed by the class along with memory reads
+    if (pcie->cfgReadAsync(0, cfg, 4, ctx.node, &req, CPL_TEST_CFG_TAG) != CPL_TEST_CFG_TAG ||
+        !pcie->waitForRequest(&req) || req.received != 4)
+    {
+        apiTestError(ctx, "configuration read with 10 bit tag not completed by the completer");
+    }
+
+    pcie->setTagBits(PCIE_TAG_BITS_8);
+}
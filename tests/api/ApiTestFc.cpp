@@ -0,0 +1,113 @@
+// =========================================================================
+//
+//  File Name:         ApiTestFc.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    C++ API test of the UpdateFC return policies
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <vector>
+
+#include "ApiTest.h"
+
+#define FC_TEST_ADDR                 0x00005000ULL
+#define FC_TEST_BYTES                32
+
+// More TLPs than the default posted and non-posted header credits
+#define FC_TEST_NUM_TLPS             (FC_DEFAULT_PHDR_CREDITS + FC_DEFAULT_PHDR_CREDITS / 2)
+
+//-------------------------------------------------------------
+// apiSetupFc()
+//
+// EP returning credits coalesced over idle periods, with the
+// class accounting for all received TLPs
+//-------------------------------------------------------------
+
+void apiSetupFc (apiTestCtx_t &ctx)
+{
+    ctx.pcie->setFcPolicy(PCIE_FC_POLICY_COALESCED);
+}
+
+//-------------------------------------------------------------
+// apiTestFc()
+//
+// Posted writes and configuration reads beyond the EP's
+// initial credits, which only complete if the EP's policy
+// returns the credits for every TLP, including the
+// configuration requests it completes itself
+//-------------------------------------------------------------
+
+void apiTestFc (apiTestCtx_t &ctx)
+{
+    pcieModelClass*        pcie = ctx.pcie;
+    std::vector<PktData_t> wbuf(FC_TEST_NUM_TLPS * FC_TEST_BYTES);
+    std::vector<PktData_t> rbuf(FC_TEST_NUM_TLPS * FC_TEST_BYTES);
+    pcieRequest_t          req;
+    PktData_t              cfg[4];
+
+    apiFill(ctx, wbuf.data(), (int)wbuf.size());
+
+    for (int idx = 0; idx < FC_TEST_NUM_TLPS; idx++)
+    {
+        pcie->memWrite(FC_TEST_ADDR + idx * FC_TEST_BYTES, &wbuf[idx * FC_TEST_BYTES], FC_TEST_BYTES, 0, ctx.node);
+    }
+
+    if (!pcie->memReadBurst(FC_TEST_ADDR, rbuf.data(), (int)rbuf.size(), ctx.node))
+    {
+        apiTestError(ctx, "read back of writes did not complete successfully");
+    }
+
+    apiCheckData(ctx, wbuf.data(), rbuf.data(), (int)wbuf.size(), "read back of writes data mismatch");
+
+    for (int idx = 0; idx < FC_TEST_NUM_TLPS; idx++)
+    {
+        pcie->cfgReadAsync(0, cfg, 4, ctx.node, &req);
+
+        if (!pcie->waitForRequest(&req))
+        {
+            apiTestError(ctx, "configuration read did not complete successfully");
+            break;
+        }
+    }
+}
+
+//-------------------------------------------------------------
+// apiCheckFc()
+//
+// EP returned posted and non-posted credits in UpdateFCs
+//-------------------------------------------------------------
+
+void apiCheckFc (apiTestCtx_t &ctx)
+{
+    if (ctx.pcie->getNumFcUpdates(FC_POST) == 0 || ctx.pcie->getNumFcUpdates(FC_NONPOST) == 0)
+    {
+        apiTestError(ctx, "no UpdateFCs sent under the coalesced policy");
+    }
+}
@@ -0,0 +1,78 @@
+// =========================================================================
+//
+//  File Name:         ApiTestFifoBlock.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    Co-sim test of block transfers between the burst FIFOs and the model
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include "ApiTest.h"
+#include "OsvvmVUser.h"
+
+// PcieModel dispatcher offsets, as in PcieInterfacePkg
+#ifndef POPWDATABURST
+#define POPWDATABURST                421
+#define PUSHRDATABURST               422
+#endif
+
+// Must match FIFO_BLOCK_BYTES and FifoBlockByte() in Tb_Pcie_Api.vhd
+#define FIFO_BLOCK_BYTES             24
+#define FIFO_BLOCK_BYTE(_idx)        (((_idx) * 7 + 3) & BYTE_MASK)
+
+//-------------------------------------------------------------
+// apiTestFifoBlock()
+//
+// The bytes loaded into the write burst FIFO by the test bench
+// fetched in one access, and pushed back inverted in one access
+// to the read burst FIFO for the test bench to check
+//-------------------------------------------------------------
+
+void apiTestFifoBlock (apiTestCtx_t &ctx)
+{
+    uint8_t buf[FIFO_BLOCK_BYTES];
+
+    VTransBurstRead(POPWDATABURST, buf, FIFO_BLOCK_BYTES, 0, ctx.node);
+
+    for (int idx = 0; idx < FIFO_BLOCK_BYTES; idx++)
+    {
+        if (buf[idx] != FIFO_BLOCK_BYTE(idx))
+        {
+            apiTestError(ctx, "POPWDATABURST data does not match the write burst FIFO");
+            break;
+        }
+    }
+
+    for (int idx = 0; idx < FIFO_BLOCK_BYTES; idx++)
+    {
+        buf[idx] = ~FIFO_BLOCK_BYTE(idx) & BYTE_MASK;
+    }
+
+    VTransBurstWrite(PUSHRDATABURST, buf, FIFO_BLOCK_BYTES, 0, ctx.node);
+}
@@ -0,0 +1,53 @@
+// =========================================================================
+//
+//  File Name:         ApiTestGen3.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    C++ API test of 8.0GT/s link training with equalization
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include "ApiTest.h"
+
+//-------------------------------------------------------------
+// apiTestGen3()
+//
+// The link, trained for 8.0GT/s on both nodes, reached L0
+// through equalization with the EP advertising 8.0GT/s
+//-------------------------------------------------------------
+
+void apiTestGen3 (apiTestCtx_t &ctx)
+{
+    TS_t ts = GetTS(0, ctx.node);
+
+    if (!(ts.datarate & TS_DATA_RATE_8GT_BIT))
+    {
+        apiTestError(ctx, "EP training sets not advertising 8.0GT/s");
+    }
+}
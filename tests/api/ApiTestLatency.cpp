@@ -0,0 +1,81 @@
+// =========================================================================
+//
+//  File Name:         ApiTestLatency.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    C++ API test of request to completion latency statistics
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include "ApiTest.h"
+
+#define LAT_TEST_ADDR                0x00008000ULL
+#define LAT_TEST_NUM_READS           20
+#define LAT_TEST_BYTES               16
+
+//-------------------------------------------------------------
+// apiTestLatency()
+//
+// Memory and configuration read latencies recorded for each
+// request, in ordered statistics
+//-------------------------------------------------------------
+
+void apiTestLatency (apiTestCtx_t &ctx)
+{
+    pcieModelClass* pcie = ctx.pcie;
+    pcieRequest_t   req;
+    PktData_t       rbuf[LAT_TEST_BYTES];
+
+    pcie->resetLatencyStats();
+
+    for (int idx = 0; idx < LAT_TEST_NUM_READS; idx++)
+    {
+        pcie->memReadAsync(LAT_TEST_ADDR, rbuf, LAT_TEST_BYTES, ctx.node, &req);
+        pcie->waitForRequest(&req);
+    }
+
+    pcie->cfgReadAsync(0, rbuf, 4, ctx.node, &req);
+    pcie->waitForRequest(&req);
+
+    if (pcie->getLatencyCount(PCIE_LAT_MEM_RD) != LAT_TEST_NUM_READS ||
+        pcie->getLatencyCount(PCIE_LAT_CFG_RD) != 1                  ||
+        pcie->getLatencyCount(PCIE_LAT_IO_RD)  != 0)
+    {
+        apiTestError(ctx, "latency counts do not match the requests made");
+    }
+
+    if (pcie->getLatencyMin(PCIE_LAT_MEM_RD) == 0 ||
+        pcie->getLatencyMin(PCIE_LAT_MEM_RD) > pcie->getLatencyPercentile(PCIE_LAT_MEM_RD, 50.0) ||
+        pcie->getLatencyPercentile(PCIE_LAT_MEM_RD, 50.0) > pcie->getLatencyMax(PCIE_LAT_MEM_RD) ||
+        pcie->getLatencyMean(PCIE_LAT_MEM_RD) < pcie->getLatencyMin(PCIE_LAT_MEM_RD) ||
+        pcie->getLatencyMean(PCIE_LAT_MEM_RD) > pcie->getLatencyMax(PCIE_LAT_MEM_RD))
+    {
+        apiTestError(ctx, "latency statistics out of order");
+    }
+}
@@ -0,0 +1,81 @@
+// =========================================================================
+//
+//  File Name:         ApiTestLinkUtil.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    C++ API test of the link utilisation monitor
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include "ApiTest.h"
+
+#define UTIL_TEST_ADDR               0x00009000ULL
+#define UTIL_TEST_BYTES              64
+#define UTIL_TEST_WINDOW             200
+
+//-------------------------------------------------------------
+// apiTestLinkUtil()
+//
+// The link utilisation monitor, enabled on both nodes, has
+// counted TLP, DLLP and ordered set symbols in each direction
+// since start up, and classifies every symbol time of a window
+//-------------------------------------------------------------
+
+void apiTestLinkUtil (apiTestCtx_t &ctx)
+{
+    pcieModelClass* pcie = ctx.pcie;
+    PktData_t       buf[UTIL_TEST_BYTES];
+    uint32_t        total = 0;
+
+    for (int type = LINK_UTIL_TLP; type <= LINK_UTIL_OS; type++)
+    {
+        if (pcie->readLinkUtil(LINK_UTIL_TX, 0, type) == 0 || pcie->readLinkUtil(LINK_UTIL_RX, 0, type) == 0)
+        {
+            apiTestError(ctx, "link utilisation count zero for traffic seen on the link");
+        }
+    }
+
+    // Restart the counts with windows, and run traffic over more than one window
+    pcie->configLinkUtil(UTIL_TEST_WINDOW);
+
+    apiFill(ctx, buf, UTIL_TEST_BYTES);
+
+    pcie->memWrite(UTIL_TEST_ADDR, buf, UTIL_TEST_BYTES, 0, ctx.node);
+    pcie->sendIdle(UTIL_TEST_WINDOW * 2);
+
+    for (int type = 0; type < LINK_UTIL_NUM_TYPES; type++)
+    {
+        total += pcie->readLinkUtil(LINK_UTIL_TX, 0, type, true);
+    }
+
+    if (total != UTIL_TEST_WINDOW)
+    {
+        apiTestError(ctx, "link utilisation window counts do not match the window length");
+    }
+}
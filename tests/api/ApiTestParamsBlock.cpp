@@ -0,0 +1,108 @@
+// =========================================================================
+//
+//  File Name:         ApiTestParamsBlock.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    Co-sim test of packed transaction parameter write-back and fetch
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include "ApiTest.h"
+#include "OsvvmVUser.h"
+
+// PcieModel dispatcher offsets, packed record word offsets and
+// receive parameter indexes, as in PcieInterfacePkg
+#ifndef GETTRANSBLOCK
+#define GETTRANSBLOCK                423
+#define SETPARAMSBLOCK               424
+#endif
+
+#define TRANS_BLOCK_PARAMS           9
+
+#define PARAM_REQ_TAG                1
+#define PARAM_REQ_RID                2
+#define PARAM_REQ_LENGTH             15
+
+#define PARAMS_BLOCK_NUM_PAIRS       3
+#define PARAMS_BLOCK_WORDS           (TRANS_BLOCK_PARAMS + PARAM_REQ_LENGTH + 1)
+
+//-------------------------------------------------------------
+// paramsBlockWrite()
+//
+// Write back (index, value) pairs as a single block, as
+// little endian 32 bit words
+//-------------------------------------------------------------
+
+static void paramsBlockWrite (apiTestCtx_t &ctx, const uint32_t* pairs, const int numPairs)
+{
+    uint8_t buf[PARAMS_BLOCK_NUM_PAIRS * 2 * 4];
+
+    for (int idx = 0; idx < numPairs * 2 * 4; idx++)
+    {
+        buf[idx] = (pairs[idx / 4] >> (8 * (idx % 4))) & BYTE_MASK;
+    }
+
+    VTransBurstWrite(SETPARAMSBLOCK, buf, numPairs * 2 * 4, 0, ctx.node);
+}
+
+//-------------------------------------------------------------
+// apiTestParamsBlock()
+//
+// Parameters written back with one SETPARAMSBLOCK access read
+// back at their packed record offsets with one GETTRANSBLOCK
+// access
+//-------------------------------------------------------------
+
+void apiTestParamsBlock (apiTestCtx_t &ctx)
+{
+    const uint32_t pairs[PARAMS_BLOCK_NUM_PAIRS * 2] = {PARAM_REQ_TAG,    0x05a,
+                                                        PARAM_REQ_RID,    0x1234,
+                                                        PARAM_REQ_LENGTH, 77};
+    const uint32_t clear[PARAMS_BLOCK_NUM_PAIRS * 2] = {PARAM_REQ_TAG,    0,
+                                                        PARAM_REQ_RID,    0,
+                                                        PARAM_REQ_LENGTH, 0};
+    uint8_t        buf[PARAMS_BLOCK_WORDS * 4];
+
+    paramsBlockWrite(ctx, pairs, PARAMS_BLOCK_NUM_PAIRS);
+
+    VTransBurstRead(GETTRANSBLOCK, buf, PARAMS_BLOCK_WORDS * 4, 0, ctx.node);
+
+    for (int pair = 0; pair < PARAMS_BLOCK_NUM_PAIRS; pair++)
+    {
+        const uint8_t* word = &buf[(TRANS_BLOCK_PARAMS + pairs[pair * 2]) * 4];
+
+        if ((word[0] | (word[1] << 8) | (word[2] << 16) | ((uint32_t)word[3] << 24)) != pairs[pair * 2 + 1])
+        {
+            apiTestError(ctx, "GETTRANSBLOCK parameter does not match that written with SETPARAMSBLOCK");
+        }
+    }
+
+    // Clear the receive parameters again before the VC interface runs
+    paramsBlockWrite(ctx, clear, PARAMS_BLOCK_NUM_PAIRS);
+}
@@ -0,0 +1,140 @@
+// =========================================================================
+//
+//  File Name:         ApiTestRng.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    C++ API test of the counter based random streams
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include "ApiTest.h"
+#include "pcieRng.h"
+
+#define RNG_TEST_SEED                0x0123456789abcdefULL
+#define RNG_TEST_FEATURE             (PCIE_RNG_STREAM_USER + 1)
+#define RNG_TEST_DRAWS               37
+#define RNG_TEST_FILL_BYTES          301
+
+// Philox4x32-10 known answers, for all zero and all one counter and key
+static const uint32_t rngKatZero[PCIE_RNG_BLOCK_WORDS] = {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8};
+static const uint32_t rngKatOnes[PCIE_RNG_BLOCK_WORDS] = {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd};
+
+static bool rngKat (const uint64_t seed, const uint64_t stream, const uint64_t block, const uint32_t* exp)
+{
+    pcieRng_t rng;
+    uint32_t  out[PCIE_RNG_BLOCK_WORDS][PCIE_RNG_BATCH_BLOCKS];
+
+    PcieRngInit(&rng, seed, stream);
+    PcieRngBatch(&rng, block, 1, out);
+
+    for (int idx = 0; idx < PCIE_RNG_BLOCK_WORDS; idx++)
+    {
+        if (out[idx][0] != exp[idx])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-------------------------------------------------------------
+// apiTestRng()
+//
+// Stream values against the known answers, and reproducible
+// by seed and feature, with jumps and payload fills keeping the
+// stream at the same position as single draws
+//-------------------------------------------------------------
+
+void apiTestRng (apiTestCtx_t &ctx)
+{
+    pcieModelClass* pcie  = ctx.pcie;
+    uint64_t        seed  = pcie->getRngSeed();
+    pcieRng_t       a, b, c;
+    PktData_t       fill[RNG_TEST_FILL_BYTES];
+    PktData_t       exp[RNG_TEST_FILL_BYTES];
+    bool            same  = true;
+    bool            other = true;
+
+    if (!rngKat(0, 0, 0, rngKatZero) || !rngKat(~0ULL, ~0ULL, ~0ULL, rngKatOnes))
+    {
+        apiTestError(ctx, "random stream does not match the known answers");
+    }
+
+    // The same seed and feature give the same stream, and another feature a different one
+    pcie->rngSeed(RNG_TEST_SEED);
+    pcie->rngStream(&a, RNG_TEST_FEATURE);
+    pcie->rngStream(&b, RNG_TEST_FEATURE);
+    pcie->rngStream(&c, RNG_TEST_FEATURE + 1);
+
+    for (int idx = 0; idx < RNG_TEST_DRAWS; idx++)
+    {
+        uint32_t val = PcieRngNext(&a);
+
+        same  = same  && val == PcieRngNext(&b);
+        other = other && val == PcieRngNext(&c);
+    }
+
+    if (!same || other)
+    {
+        apiTestError(ctx, "random streams not reproducible by seed and feature");
+    }
+
+    // A jump lands where single draws do
+    pcie->rngStream(&c, RNG_TEST_FEATURE);
+    PcieRngJump(&c, RNG_TEST_DRAWS);
+
+    if (PcieRngNext(&c) != PcieRngNext(&a))
+    {
+        apiTestError(ctx, "random stream jump out of step with draws");
+    }
+
+    // A fill from an unaligned position matches the bytes of single draws, and leaves
+    // the stream in step
+    PcieRngFill(&a, fill, RNG_TEST_FILL_BYTES);
+
+    for (int idx = 0; idx < RNG_TEST_FILL_BYTES; idx += 4)
+    {
+        uint32_t word = PcieRngNext(&c);
+
+        for (int k = 0; k < 4 && idx + k < RNG_TEST_FILL_BYTES; k++)
+        {
+            exp[idx + k] = (word >> (8 * k)) & BYTE_MASK;
+        }
+    }
+
+    apiCheckData(ctx, exp, fill, RNG_TEST_FILL_BYTES, "random stream fill differs from single draws");
+
+    if (PcieRngNext(&a) != PcieRngNext(&c))
+    {
+        apiTestError(ctx, "random stream fill out of step with draws");
+    }
+
+    pcie->rngSeed(seed);
+}
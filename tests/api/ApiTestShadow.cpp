@@ -0,0 +1,94 @@
+// =========================================================================
+//
+//  File Name:         ApiTestShadow.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    C++ API test of shadow memory read data checking
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include "ApiTest.h"
+
+#define SHADOW_TEST_ADDR             0x0000a000ULL
+#define SHADOW_TEST_BYTES            64
+#define SHADOW_TEST_CORRUPT_OFFSET   16
+#define SHADOW_TEST_CORRUPT_BYTES    16
+
+//-------------------------------------------------------------
+// apiTestShadow()
+//
+// Reads of data written with the shadow enabled check clean,
+// and a read after bytes were changed behind the shadow is
+// counted as a single mismatching read of just those bytes
+//-------------------------------------------------------------
+
+void apiTestShadow (apiTestCtx_t &ctx)
+{
+    pcieModelClass* pcie = ctx.pcie;
+    pcieRequest_t   req;
+    PktData_t       wbuf[SHADOW_TEST_BYTES];
+    PktData_t       rbuf[SHADOW_TEST_BYTES];
+
+    apiFill(ctx, wbuf, SHADOW_TEST_BYTES);
+
+    pcie->enableShadow(true, false);
+    pcie->clearShadow();
+    pcie->resetShadowStats();
+
+    pcie->memWrite(SHADOW_TEST_ADDR, wbuf, SHADOW_TEST_BYTES, 0, ctx.node);
+    pcie->memReadAsync(SHADOW_TEST_ADDR, rbuf, SHADOW_TEST_BYTES, ctx.node, &req);
+    pcie->waitForRequest(&req);
+
+    if (pcie->getShadowChecks() != 1 || pcie->getShadowMismatches() != 0)
+    {
+        apiTestError(ctx, "shadow check of written data failed");
+    }
+
+    // Change some of the bytes without the shadow seeing the write
+    for (int idx = 0; idx < SHADOW_TEST_CORRUPT_BYTES; idx++)
+    {
+        wbuf[idx] = ~wbuf[SHADOW_TEST_CORRUPT_OFFSET + idx] & BYTE_MASK;
+    }
+
+    pcie->enableShadow(false);
+    pcie->memWrite(SHADOW_TEST_ADDR + SHADOW_TEST_CORRUPT_OFFSET, wbuf, SHADOW_TEST_CORRUPT_BYTES, 0, ctx.node);
+    pcie->enableShadow(true, false);
+
+    pcie->memReadAsync(SHADOW_TEST_ADDR, rbuf, SHADOW_TEST_BYTES, ctx.node, &req);
+    pcie->waitForRequest(&req);
+
+    if (pcie->getShadowChecks() != 2 || pcie->getShadowMismatches() != 1 ||
+        pcie->getShadowMismatchBytes() != SHADOW_TEST_CORRUPT_BYTES)
+    {
+        apiTestError(ctx, "shadow check did not find the bytes changed behind it");
+    }
+
+    pcie->enableShadow(false);
+    pcie->clearShadow();
+}
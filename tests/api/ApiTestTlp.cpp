@@ -0,0 +1,107 @@
+// =========================================================================
+//
+//  File Name:         ApiTestTlp.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    C++ API test of the owning received packet handle
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include "ApiTest.h"
+
+#define TLP_TEST_BYTES               8
+#define TLP_TEST_VEND_DATA           0x5a5a0001ULL
+
+// Payload of the vendor message, known to both nodes
+static PktData_t tlpTestByte (const int idx)
+{
+    return (idx * 0x25 + 0x11) & BYTE_MASK;
+}
+
+//-------------------------------------------------------------
+// apiTestTlp()
+//
+// Sends the EP a vendor defined message, which the class does
+// not consume, for the EP's packet handle callback
+//-------------------------------------------------------------
+
+void apiTestTlp (apiTestCtx_t &ctx)
+{
+    PktData_t wbuf[TLP_TEST_BYTES];
+
+    for (int idx = 0; idx < TLP_TEST_BYTES; idx++)
+    {
+        wbuf[idx] = tlpTestByte(idx);
+    }
+
+    ctx.pcie->message(MSG_VENDOR_1, wbuf, TLP_TEST_BYTES, 0, ctx.node, TLP_TEST_VEND_DATA);
+    ctx.pcie->sendIdle(1);
+}
+
+//-------------------------------------------------------------
+// apiCheckTlp()
+//
+// The vendor message was moved out of the EP's callback into the
+// context, and is checked and claimed here before its handle
+// discards it
+//-------------------------------------------------------------
+
+void apiCheckTlp (apiTestCtx_t &ctx)
+{
+    PktData_t       exp[TLP_TEST_BYTES];
+    const pcieTlp  &tlp = ctx.lastTlp;
+
+    if (!tlp.isTlp() || ctx.unexpected < 1)
+    {
+        apiTestError(ctx, "no TLP kept by the packet handle callback");
+        return;
+    }
+
+    if ((tlp.header().type & MSG_IDENTIFIER_BITS) != MSG_IDENTIFIER_VALUE || !tlp.header().hasData ||
+        tlp.data()[MSG_CODE_OFFSET] != MSG_VENDOR_1 || tlp.headerBytes() != 16)
+    {
+        apiTestError(ctx, "kept TLP is not the vendor message sent");
+    }
+    else if (tlp.payloadBytes() != TLP_TEST_BYTES)
+    {
+        apiTestError(ctx, "kept vendor message payload length incorrect");
+    }
+    else
+    {
+        for (int idx = 0; idx < TLP_TEST_BYTES; idx++)
+        {
+            exp[idx] = tlpTestByte(idx);
+        }
+
+        apiCheckData(ctx, exp, tlp.payloadPtr(), TLP_TEST_BYTES, "kept vendor message payload mismatch");
+    }
+
+    ctx.unexpected--;
+    ctx.lastTlp.reset();
+}
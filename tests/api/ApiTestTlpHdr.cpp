@@ -0,0 +1,87 @@
+// =========================================================================
+//
+//  File Name:         ApiTestTlpHdr.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    C++ API test of the decoded headers of received TLPs
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include "ApiTest.h"
+
+#define HDR_TEST_ADDR                0x0000d014ULL
+#define HDR_TEST_BYTES               8
+#define HDR_TEST_TAG                 0x95
+#define HDR_TEST_WAIT_CYCLES         400
+
+//-------------------------------------------------------------
+// apiTestTlpHdr()
+//
+// The completion for a read not tracked by the class reaches
+// the RC's batch callback, and its decoded header is checked
+// against the request
+//-------------------------------------------------------------
+
+void apiTestTlpHdr (apiTestCtx_t &ctx)
+{
+    pcieModelClass* pcie       = ctx.pcie;
+    int             unexpected = ctx.unexpected;
+
+    ctx.lastHdr = pcieTlpHdr_t();
+
+    pcie->memRead(HDR_TEST_ADDR, HDR_TEST_BYTES, HDR_TEST_TAG, ctx.node);
+    pcie->sendIdle(HDR_TEST_WAIT_CYCLES);
+
+    if (ctx.unexpected - unexpected != 1)
+    {
+        apiTestError(ctx, "no completion received for header decode");
+        return;
+    }
+
+    const pcieTlpHdr_t &hdr = ctx.lastHdr;
+
+    if (!hdr.isCpl || !hdr.hasData || hdr.is4dw || hdr.poisoned || hdr.digest)
+    {
+        apiTestError(ctx, "decoded completion header flags incorrect");
+    }
+
+    if (hdr.tag                 != HDR_TEST_TAG                 ||
+        hdr.rid                 != ctx.node                     ||
+        hdr.cplStatus           != CPL_SUCCESS                  ||
+        hdr.length              != HDR_TEST_BYTES/4             ||
+        hdr.byteCount           != HDR_TEST_BYTES               ||
+        hdr.addr                != (HDR_TEST_ADDR & 0x7f)       ||
+        hdr.payloadOffset       != TLP_DATA_OFFSET32            ||
+        hdr.tc                  != 0)
+    {
+        apiTestError(ctx, "decoded completion header fields do not match the request");
+    }
+
+    ctx.unexpected = unexpected;
+}
@@ -0,0 +1,82 @@
+// =========================================================================
+//
+//  File Name:         ApiTestTrafficGen.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    C++ API test of the autonomous memory traffic generator
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include "ApiTest.h"
+#include "pcieTrafficGen.h"
+
+#define TGEN_TEST_ADDR               0x00010000ULL
+#define TGEN_TEST_RANGE              0x4000
+#define TGEN_TEST_MIN_LEN            4
+#define TGEN_TEST_MAX_LEN            128
+#define TGEN_TEST_OUTSTANDING        8
+#define TGEN_TEST_NUM_TRANS          200
+
+//-------------------------------------------------------------
+// apiTestTrafficGen()
+//
+// A mixed run of the traffic generator issued every
+// transaction, with all read data matching that written
+//-------------------------------------------------------------
+
+void apiTestTrafficGen (apiTestCtx_t &ctx)
+{
+    pcieTrafficGen     tgen(ctx.pcie);
+    pcieTrafficStats_t stats;
+
+    tgen.setMix(1, 1);
+    tgen.setAddrRange(TGEN_TEST_ADDR, TGEN_TEST_RANGE);
+    tgen.setLength(TGEN_TEST_MIN_LEN, TGEN_TEST_MAX_LEN);
+    tgen.setMaxOutstanding(TGEN_TEST_OUTSTANDING);
+
+    if (!tgen.run(TGEN_TEST_NUM_TRANS))
+    {
+        apiTestError(ctx, "traffic generator run reported read errors");
+    }
+
+    stats = tgen.getStats();
+
+    if (stats.numWrites + stats.numReads != TGEN_TEST_NUM_TRANS || stats.numWrites == 0 || stats.numReads == 0)
+    {
+        apiTestError(ctx, "traffic generator transaction counts do not match the run");
+    }
+
+    if (stats.numMismatches || stats.numFailed || stats.endCycle <= stats.startCycle)
+    {
+        apiTestError(ctx, "traffic generator statistics show errors");
+    }
+
+    // Return to all tags being usable for the tests that follow
+    tgen.setMaxOutstanding(0);
+}
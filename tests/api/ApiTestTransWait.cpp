@@ -0,0 +1,84 @@
+// =========================================================================
+//
+//  File Name:         ApiTestTransWait.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    Co-sim test of the blocking wait for transactions
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include "ApiTest.h"
+
+// PcieModel dispatcher offset and wait status, as in PcieInterfacePkg
+#ifndef GETNEXTTRANSWAIT
+#define GETNEXTTRANSWAIT             425
+#endif
+
+#define TRANS_WAIT_LINK_ACTIVE       -2
+
+#define TRANS_WAIT_DRAIN_CYCLES      100
+#define TRANS_WAIT_ADDR              0x0000b000ULL
+#define TRANS_WAIT_BYTES             32
+
+//-------------------------------------------------------------
+// apiCheckTransWait()
+//
+// With the EP given no transaction and the RC clocking the link
+// from its VC interface, a blocking wait started after a SKP
+// ordered set returns at once with the link partner active, as
+// does a second wait while the RC symbols it held are still to
+// be returned. The link then carries on once clocked normally,
+// with any lost or corrupted symbols raising model errors.
+//-------------------------------------------------------------
+
+void apiCheckTransWait (apiTestCtx_t &ctx)
+{
+    pcieModelClass* pcie = ctx.pcie;
+    PktData_t       buf[TRANS_WAIT_BYTES];
+    unsigned        status;
+
+    for (int idx = 0; idx < 2; idx++)
+    {
+        pcie->sendOs(SKP);
+
+        VRead(GETNEXTTRANSWAIT, &status, 0, ctx.node);
+
+        if ((int)status != TRANS_WAIT_LINK_ACTIVE)
+        {
+            apiTestError(ctx, "GETNEXTTRANSWAIT did not return with the link partner active");
+        }
+    }
+
+    pcie->sendIdle(TRANS_WAIT_DRAIN_CYCLES);
+
+    apiFill(ctx, buf, TRANS_WAIT_BYTES);
+    pcie->memWrite(TRANS_WAIT_ADDR, buf, TRANS_WAIT_BYTES, 0, ctx.node);
+
+    pcie->sendIdle(TRANS_WAIT_DRAIN_CYCLES);
+}
@@ -0,0 +1,133 @@
+// =========================================================================
+//
+//  File Name:         ApiTestVc.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    C++ API test of virtual channels
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <vector>
+
+#include "ApiTest.h"
+
+#define VC_TEST_TC                   1
+#define VC_TEST_VC                   1
+#define VC_TEST_ADDR                 0x00007000ULL
+#define VC_TEST_NUM_WRITES           16
+#define VC_TEST_BYTES                32
+#define VC_TEST_INIT_CYCLES          2000
+
+// EP's VC1 received credits, fewer than the test's writes need
+#define VC_TEST_PHDR                 4
+#define VC_TEST_PDATA                8
+#define VC_TEST_NPHDR                4
+#define VC_TEST_NPDATA               1
+
+//-------------------------------------------------------------
+// apiSetupVc()
+//
+// EP VC1 with finite credits, for TC1
+//-------------------------------------------------------------
+
+void apiSetupVc (apiTestCtx_t &ctx)
+{
+    ctx.pcie->setTcVcMap(VC_TEST_TC, VC_TEST_VC);
+    ctx.pcie->initVc(VC_TEST_VC, VC_TEST_PHDR, VC_TEST_PDATA, VC_TEST_NPHDR, VC_TEST_NPDATA);
+}
+
+//-------------------------------------------------------------
+// apiTestVc()
+//
+// Writes on VC1 needing more credits than the EP advertises,
+// so that they are sent as the EP returns them, read back
+// on VC1
+//-------------------------------------------------------------
+
+void apiTestVc (apiTestCtx_t &ctx)
+{
+    pcieModelClass*        pcie = ctx.pcie;
+    std::vector<PktData_t> wbuf(VC_TEST_NUM_WRITES * VC_TEST_BYTES);
+    std::vector<PktData_t> rbuf(VC_TEST_NUM_WRITES * VC_TEST_BYTES);
+    pcieRequest_t          req;
+
+    // The model's own flow control would charge the VC1 TLPs to the EP's VC0 credits, which
+    // the EP's policy does not return
+    pcie->setFcPolicy(PCIE_FC_POLICY_IMMEDIATE);
+
+    pcie->setTcVcMap(VC_TEST_TC, VC_TEST_VC);
+    pcie->initVc(VC_TEST_VC, FC_INFINITE_CREDITS, FC_INFINITE_CREDITS, FC_INFINITE_CREDITS, FC_INFINITE_CREDITS);
+
+    for (int cycles = 0; !pcie->isVcInit(VC_TEST_VC) && cycles < VC_TEST_INIT_CYCLES; cycles++)
+    {
+        pcie->sendIdle();
+    }
+
+    if (!pcie->isVcInit(VC_TEST_VC))
+    {
+        apiTestError(ctx, "VC flow control initialisation did not complete");
+        return;
+    }
+
+    apiFill(ctx, wbuf.data(), (int)wbuf.size());
+
+    for (int idx = 0; idx < VC_TEST_NUM_WRITES; idx++)
+    {
+        pcie->memWriteTc(VC_TEST_ADDR + idx * VC_TEST_BYTES, &wbuf[idx * VC_TEST_BYTES], VC_TEST_BYTES, VC_TEST_TC, ctx.node);
+    }
+
+    pcie->memReadTc(VC_TEST_ADDR, rbuf.data(), (int)rbuf.size(), VC_TEST_TC, ctx.node, &req);
+
+    if (!pcie->sendVc())
+    {
+        apiTestError(ctx, "VC TLPs blocked for credits");
+        return;
+    }
+
+    if (!pcie->waitForRequest(&req))
+    {
+        apiTestError(ctx, "VC read did not complete successfully");
+    }
+
+    apiCheckData(ctx, wbuf.data(), rbuf.data(), (int)wbuf.size(), "VC read data mismatch");
+}
+
+//-------------------------------------------------------------
+// apiCheckVc()
+//
+// EP completed VC1 flow control initialisation
+//-------------------------------------------------------------
+
+void apiCheckVc (apiTestCtx_t &ctx)
+{
+    if (!ctx.pcie->isVcInit(VC_TEST_VC))
+    {
+        apiTestError(ctx, "EP VC flow control initialisation did not complete");
+    }
+}
@@ -0,0 +1,294 @@
+// =========================================================================
+//
+//  File Name:         VUserMainApi.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//    Simon Southwell      simon.southwell@gmail.com
+//
+//  Description:
+//    Co-sim test of the PCIe model C++ API, with both nodes driven from
+//    pcieModelClass rather than the VHDL transaction interface. The RC
+//    (node 62) runs the requester tests in order, whilst the EP (node 63),
+//    set up for the tests beforehand, completes their requests and checks
+//    its side once they are done. Errors are raised as model alerts, and
+//    each node then hands over to the VC interface, so the test bench's
+//    first transaction on a node completes once its tests have finished.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial Version
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <atomic>
+#include <utility>
+
+#include "ApiTest.h"
+
+extern "C" {
+#include "ltssm.h"
+}
+
+#include "pcieVcInterface.h"
+
+#define DRAIN_CYCLES                 200
+
+// Node receive callbacks
+#define RX_MODE_BATCH                0
+#define RX_MODE_TLP                  1
+
+// Requester tests, run in order by the RC
+static const apiTest_t rcTests[] = {
+    apiTestGen3,
+    apiTestAsyncReads,
+    apiTestBursts,
+    apiTestCompleter,
+    apiTestFc,
+    apiTestAck,
+    apiTestVc,
+    apiTestLatency,
+    apiTestLinkUtil,
+    apiTestTrafficGen,
+    apiTestShadow,
+    apiTestFifoBlock,
+    apiTestParamsBlock,
+    apiTestBatch,
+    apiTestTlpHdr,
+    apiTestCoSched,
+    apiTestAspm,
+    apiTestRng,
+    apiTestTlp,
+    NULL
+};
+
+// EP set up, before the RC starts its tests
+static const apiTest_t epSetup[] = {
+    apiSetupCompleter,
+    apiSetupFc,
+    apiSetupAck,
+    apiSetupVc,
+    NULL
+};
+
+// EP checks, once the RC has finished its tests
+static const apiTest_t epChecks[] = {
+    apiCheckFc,
+    apiCheckAck,
+    apiCheckVc,
+    apiCheckTransWait,
+    apiCheckTlp,
+    apiCheckAspm,
+    NULL
+};
+
+// Test progress shared between the node threads
+static std::atomic<bool> epReady(false);
+static std::atomic<bool> rcDone(false);
+
+//-------------------------------------------------------------
+// Error reporting, counting errors and raising a model alert
+//-------------------------------------------------------------
+
+void apiTestError (apiTestCtx_t &ctx, const char* msg)
+{
+    VPrint("VUserMainApi: ***Error --- %s (node %d)\n", msg, ctx.node);
+
+    VWrite(PVH_FATAL, 0, 0, ctx.node);
+
+    ctx.errors++;
+}
+
+void apiCheckData (apiTestCtx_t &ctx, const PktData_t* exp, const PktData_t* act, const int length, const char* msg)
+{
+    for (int idx = 0; idx < length; idx++)
+    {
+        if ((exp[idx] & BYTE_MASK) != (act[idx] & BYTE_MASK))
+        {
+            apiTestError(ctx, msg);
+            return;
+        }
+    }
+}
+
+//-------------------------------------------------------------
+// Fill a buffer with random bytes
+//-------------------------------------------------------------
+
+void apiFill (apiTestCtx_t &ctx, PktData_t* buf, const int length)
+{
+    for (int idx = 0; idx < length; idx++)
+    {
+        buf[idx] = ctx.pcie->pcieRand() & BYTE_MASK;
+    }
+}
+
+//-------------------------------------------------------------
+// Received TLPs not consumed by the class are counted as
+// unexpected, unless claimed by a test
+//-------------------------------------------------------------
+
+static void rxTlpCallback (pcieTlp &&tlp, void* usrptr)
+{
+    apiTestCtx_t* ctx = (apiTestCtx_t*)usrptr;
+
+    // Kept for the EP's checks, with DLLPs discarded on return
+    if (tlp.isTlp())
+    {
+        ctx->unexpected++;
+        ctx->lastTlp = std::move(tlp);
+    }
+    else if (tlp.status() == PKT_STATUS_GOOD)
+    {
+        AspmRxDllp(tlp.data(), ctx->node);
+    }
+}
+
+// The RC's received TLPs arrive in batches, with the views discarded
+// by the class on return
+static void rxBatchCallback (const pcieRxView_t* pkts, const int count, void* usrptr)
+{
+    apiTestCtx_t* ctx = (apiTestCtx_t*)usrptr;
+
+    for (int idx = 0; idx < count; idx++)
+    {
+        if (pkts[idx].seq != DLLP_SEQ_ID)
+        {
+            ctx->unexpected++;
+            ctx->lastHdr = pkts[idx].hdr;
+        }
+        else if (pkts[idx].status == PKT_STATUS_GOOD)
+        {
+            AspmRxDllp(pkts[idx].data, ctx->node);
+        }
+    }
+
+    ctx->batches++;
+}
+
+//-------------------------------------------------------------
+// Link and flow control initialisation for a node
+//-------------------------------------------------------------
+
+static void initNode (apiTestCtx_t &ctx, const int rxMode)
+{
+    unsigned lanes;
+
+    if (rxMode == RX_MODE_BATCH)
+    {
+        ctx.pcie->initialisePcieBatch(rxBatchCallback, &ctx);
+    }
+    else
+    {
+        ctx.pcie->initialisePcieTlp(rxTlpCallback, &ctx);
+    }
+
+    VRead(LANESADDR, &lanes, 0, ctx.node);
+
+    // Trained at 8.0GT/s, which is model to model only, so that the link goes
+    // through Recovery.Equalization before reaching L0
+    ConfigurePcieLtssm(CONFIG_LTSSM_GEN3_MODEL_ONLY, 1, ctx.node);
+    InitLinkGen(lanes, TS_DATA_RATE_GEN3, ctx.node);
+
+    ctx.pcie->initFc();
+}
+
+static void runTests (apiTestCtx_t &ctx, const apiTest_t* tests)
+{
+    for (int idx = 0; tests[idx] != NULL; idx++)
+    {
+        tests[idx](ctx);
+    }
+}
+
+//-------------------------------------------------------------
+// Report the node's results and hand over to the VC interface,
+// which should not return
+//-------------------------------------------------------------
+
+static void finishNode (apiTestCtx_t &ctx, const char* name)
+{
+    if (ctx.unexpected)
+    {
+        apiTestError(ctx, "unexpected packets received");
+    }
+
+    VPrint("VUserMainApi: %s tests finished with %d errors (node %d)\n", name, ctx.errors, ctx.node);
+
+    pcieVcInterface *vc = new pcieVcInterface(ctx.node);
+
+    vc->run();
+}
+
+//-------------------------------------------------------------
+// VUserMain62()
+//
+// RC: requester tests
+//-------------------------------------------------------------
+
+extern "C" void VUserMain62 (int node)
+{
+    pcieModelClass pcie(node);
+    apiTestCtx_t   ctx = {&pcie, (unsigned)node, 0, 0, 0, pcieTlpHdr_t(), pcieTlp()};
+
+    initNode(ctx, RX_MODE_BATCH);
+
+    while (!epReady)
+    {
+        pcie.sendIdle(1);
+    }
+
+    runTests(ctx, rcTests);
+
+    rcDone = true;
+
+    finishNode(ctx, "RC");
+}
+
+//-------------------------------------------------------------
+// VUserMain63()
+//
+// EP: completes the RC's requests
+//-------------------------------------------------------------
+
+extern "C" void VUserMain63 (int node)
+{
+    pcieModelClass pcie(node);
+    apiTestCtx_t   ctx = {&pcie, (unsigned)node, 0, 0, 0, pcieTlpHdr_t(), pcieTlp()};
+
+    initNode(ctx, RX_MODE_TLP);
+
+    runTests(ctx, epSetup);
+
+    epReady = true;
+
+    while (!rcDone)
+    {
+        apiIdleAspm(ctx);
+    }
+
+    // Let any last DLLPs go
+    pcie.sendIdle(DRAIN_CYCLES);
+
+    runTests(ctx, epChecks);
+
+    finishNode(ctx, "EP");
+}